@@ -21,10 +21,15 @@
 //  IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #import <UIKit/UIKit.h>
+#import "TOPagingViewEventRing.h"
+#import "TOPagingViewResourcePolicy.h"
+#import "TOPagingViewPageLoader.h"
+#import "TOPagingViewSnapshotStore.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
 @class TOPagingView;
+@class TOPagingViewCoordinator;
 
 //-------------------------------------------------------------------
 
@@ -49,6 +54,43 @@ typedef NS_ENUM(NSInteger, TOPagingViewPageType) {
     TOPagingViewPageTypePrevious
 } NS_SWIFT_NAME(PagingViewPageType);
 
+/// An enumeration of the animations that may be played when skipping to a new page.
+typedef NS_ENUM(NSInteger, TOPagingViewSkipTransitionStyle) {
+    /// The old page is moved beside the new one, and the scroll view scrolls between them.
+    TOPagingViewSkipTransitionStyleScroll,
+
+    /// A snapshot of the old page fades out over the new page.
+    TOPagingViewSkipTransitionStyleCrossFade,
+
+    /// A snapshot of the old page slides out as the new page slides in.
+    TOPagingViewSkipTransitionStyleSlide
+} NS_SWIFT_NAME(PagingViewSkipTransitionStyle);
+
+/// Counters describing the work a paging view has performed, used for performance monitoring.
+typedef struct TOPagingViewMetrics {
+    /// The number of times the scroll view's content inset was written to enable or disable a page slot.
+    NSUInteger contentInsetWriteCount;
+
+    /// The number of times a page view was requested from the data source.
+    NSUInteger dataSourceRequestCount;
+
+    /// The number of data source requests made beyond what the transition that caused them was expected to need.
+    /// Anything above zero means the same page was requested more than once.
+    NSUInteger dataSourceBudgetOverrunCount;
+} TOPagingViewMetrics NS_SWIFT_NAME(PagingViewMetrics);
+
+/// A summary of a run of page turns, delivered as a single event once the interaction that caused them has settled.
+typedef struct TOPagingViewPageTurnBatch {
+    /// The net number of pages turned, counting next pages as positive and previous pages as negative.
+    NSInteger netPageOffset;
+
+    /// The total number of page turns in the batch.
+    NSUInteger turnCount;
+
+    /// The type of page the most recent turn in the batch moved to.
+    TOPagingViewPageType finalPageType;
+} TOPagingViewPageTurnBatch NS_SWIFT_NAME(PagingViewPageTurnBatch);
+
 //-------------------------------------------------------------------
 
 /// Optional protocol that page views may implement.
@@ -68,13 +110,21 @@ NS_SWIFT_NAME(PagingViewPage)
 /// A globally unique identifier that can be used to uniquely tag this specific
 /// page object. This can be used to retrieve the page from the pager view at a later
 /// time.
+///
+/// This is read once each time the page is inserted into the paging view, and cached
+/// until the page is next re-used.
 - (NSString *)uniqueIdentifier;
 
-/// Called just before the page object is removed from the visible page set,
-/// and re-enqueud by the data source.
+/// Called just before a recycled page object is dequeued by the data source to be re-used.
+///
+/// This is not called when the page leaves the screen. Until it is dequeued, a recycled page keeps
+/// its content so it may still be retrieved with `pageViewForUniqueIdentifier:` and returned to
+/// the paging view without being reconfigured. Up to the `pagePoolCapacity` limit of the paging view's
+/// `resourcePolicy` can be held this way. Pages dropped from the pool are released without this being called.
 ///
 /// Use this method to return the page to a default state, and to clear out any
-/// references to memory-heavy objects like images.
+/// references to memory-heavy objects like images. Work that must stop as soon as the page
+/// leaves the screen belongs in `didBecomeHidden` instead.
 - (void)prepareForReuse;
 
 /// The current page on screen is the first page in the current sequence.
@@ -87,6 +137,21 @@ NS_SWIFT_NAME(PagingViewPage)
 /// - Parameter direction: The ascending direction that the pages will flow in.
 - (void)setPageDirection:(TOPagingViewDirection)direction;
 
+/// Called just before this page becomes the current page, either from a page turn, a skip, or the initial layout.
+/// Use this to resume any work, like timers, video or animations, that should only run while the page is visible.
+- (void)willBecomeCurrentPage;
+
+/// Called once this page has become the current page.
+- (void)didBecomeCurrentPage;
+
+/// Called when this page has been placed in the next or previous slot, just off-screen beside the current page.
+/// Use this to suspend any work that doesn't need to run until the page is visible again.
+- (void)didMoveToAdjacentSlot;
+
+/// Called when this page has been removed from all of the slots and recycled.
+/// Use this to stop any remaining work. `prepareForReuse` will still be called later if the page is re-used.
+- (void)didBecomeHidden;
+
 @end
 
 // -------------------------------------------------------------------
@@ -133,6 +198,35 @@ NS_SWIFT_NAME(PagingViewDataDelegate)
 /// @param direction The new direction in which the pages are flowing.
 - (void)pagingView:(TOPagingView *)pagingView didChangeToPageDirection:(TOPagingViewDirection)direction;
 
+/// When `isPageTurnBatchingEnabled` is set, called once a run of page turns has settled (ie, the user has stopped
+/// dragging, the scroll view has stopped decelerating, and any animations have completed), summarizing all of them.
+/// `pagingView:didTurnToPageOfType:` is still called for every turn, so keep that one lightweight, and perform any
+/// expensive work, like saving state or updating UI, here instead.
+/// @param pagingView The calling paging view instance.
+/// @param batch A summary of all of the page turns since the last batch was delivered.
+- (void)pagingView:(TOPagingView *)pagingView didTurnPagesInBatch:(TOPagingViewPageTurnBatch)batch;
+
+/// Called when the user presses Home, End or a number key to jump to a relative position in the content.
+/// Update the data source so the page at that position will be returned as the new current page, and then
+/// return which way it lies from the current page so the paging view can skip to it. If implemented, these keys
+/// are added to the paging view's keyboard commands.
+/// @param pagingView The calling paging view instance.
+/// @param fraction The requested position in the content, from 0.0 (Home) to 1.0 (End). The number keys 1 to 9
+/// request 0.1 to 0.9, and 0 requests 1.0.
+/// @return `TOPagingViewPageTypeNext` or `TOPagingViewPageTypePrevious` to skip in that direction, or
+/// `TOPagingViewPageTypeCurrent` to stay on the current page.
+- (TOPagingViewPageType)pagingView:(TOPagingView *)pagingView willSkipToPageAtFraction:(CGFloat)fraction;
+
+/// When `isMomentumFlingingEnabled` is set, called when the user flings fast enough to travel past more than one page.
+/// Update the data source so the landing page will be returned as the new current page, and return how many pages
+/// were actually travelled (eg, fewer if the end of the content was reached). Return 0 (without updating the
+/// data source) to turn a single page as normal instead. Any linked paging views will skip to match, so their data
+/// sources must be updated here too.
+/// @param pagingView The calling paging view instance.
+/// @param numberOfPages The number of pages the fling would travel. Positive values are next pages, and negative are previous.
+/// @return The number of pages actually travelled, in the same direction.
+- (NSInteger)pagingView:(TOPagingView *)pagingView willSkipByNumberOfPages:(NSInteger)numberOfPages;
+
 @end
 
 //-------------------------------------------------------------------
@@ -163,6 +257,66 @@ NS_SWIFT_NAME(PagingView)
 /// with `pageScrollDirection` automatically updating to match.
 @property (nonatomic, assign) BOOL isDynamicPageDirectionEnabled;
 
+/// The animation played when skipping to a new page (default is `TOPagingViewSkipTransitionStyleScroll`).
+/// The snapshot based styles reclaim the old page immediately, so only the new page is laid out during the animation.
+/// Its adjacent pages are requested once the animation completes.
+@property (nonatomic, assign) TOPagingViewSkipTransitionStyle skipTransitionStyle;
+
+/// Accumulates page turns during a continuous interaction, and delivers them to the delegate as a single
+/// `pagingView:didTurnPagesInBatch:` event once the interaction settles (default is NO).
+@property (nonatomic, assign) BOOL isPageTurnBatchingEnabled;
+
+/// When the size changes repeatedly in quick succession (eg, while live resizing a window in Stage Manager),
+/// covers the paging view with a stretched snapshot of the current page instead of re-laying out the pages at every step.
+/// The real pages are laid out once the size settles, with the adjacent pages resized lazily afterwards.
+/// Turning or skipping pages ends the live resize straight away (default is NO).
+@property (nonatomic, assign) BOOL isLiveResizeDeferralEnabled;
+
+/// When the app enters the background, releases the recycled pages and the adjacent pages so only the current page
+/// is kept in memory, making the app less likely to be terminated. The adjacent pages are requested again, one per
+/// layout pass, once the app returns to the foreground (default is NO).
+@property (nonatomic, assign) BOOL isBackgroundPageReleasingEnabled;
+
+/// Allows a fast fling to travel past multiple pages, with the number of pages based on the release velocity.
+/// The pages in between are represented by lightweight placeholders, so only the landing page and its
+/// neighbours are requested from the data source. Requires `pagingView:willSkipByNumberOfPages:` (default is NO).
+@property (nonatomic, assign) BOOL isMomentumFlingingEnabled;
+
+/// Tracks how long the user spends on each page, and uses it to defer requesting the adjacent pages from the data
+/// source, and preparing them, until shortly before the next page turn is predicted, rather than immediately after
+/// the last one. The pages are requested straight away if the user starts dragging or a page is turned
+/// programmatically before then. Linked paging views always request their pages straight away (default is NO).
+@property (nonatomic, assign) BOOL isReadingPaceEstimationEnabled;
+
+/// When reading pace estimation is enabled, the average time the user spends on each page, or 0 if not yet known.
+@property (nonatomic, readonly) NSTimeInterval estimatedPageDwellTime;
+
+/// The policy deciding how many recycled pages are kept, and whether adjacent pages are prepared ahead of time.
+/// Defaults to the shared `TOPagingViewDefaultResourcePolicy`, which keeps up to 4 recycled pages per page class,
+/// and backs off when the device is hot or in Low Power Mode. Use a policy with a high `pagePoolCapacity` to keep
+/// every recycled page, as before these policies were introduced.
+@property (nonatomic, strong, null_resettable) id<TOPagingViewResourcePolicy> resourcePolicy;
+
+/// An optional loader for fetching page content over the network. Requests made with a page view as their owner are
+/// re-prioritized as the page moves between slots, and are cancelled as soon as the page is recycled.
+@property (nonatomic, strong, nullable) TOPagingViewPageLoader *pageLoader;
+
+/// An optional store of page snapshots persisted across launches. When set, a page with a unique identifier is covered
+/// with its last snapshot as soon as it is inserted, until `pageViewDidFinishLoadingContent:` is called for it.
+/// Pages are snapshotted once their content has loaded, the next time the user isn't interacting.
+@property (nonatomic, strong, nullable) TOPagingViewSnapshotStore *snapshotStore;
+
+/// When set, turns, skips, reloads and direction changes are published into this ring as they happen,
+/// so they may be consumed on a background thread instead of via the delegate. Multiple paging views may share a ring.
+@property (nonatomic, strong, nullable) TOPagingViewEventRing *eventRing;
+
+/// Counters of the work this paging view has performed since it was created, or since `resetMetrics` was last called.
+@property (nonatomic, readonly) TOPagingViewMetrics metrics;
+
+/// The coordinator this paging view is linked to, if any.
+/// Use `-[TOPagingViewCoordinator addPagingView:]` to link paging views together.
+@property (nonatomic, weak, readonly, nullable) TOPagingViewCoordinator *coordinator;
+
 /// Registers a page view class that can be automatically instantiated as needed.
 /// If the class overrides `pageIdentifier`, new instances may automatically be created
 /// when needed. Any classes that do not override that property will become the default
@@ -172,6 +326,9 @@ NS_SWIFT_NAME(PagingView)
 /// Reload the view from scratch, including tearing down and recreating all page views
 - (void)reload;
 
+/// Resets all of the counters in `metrics` back to zero.
+- (void)resetMetrics;
+
 /// Tears down and recreates the previous and next page views from scratch, but leaves the current one alone.
 - (void)reloadAdjacentPages;
 
@@ -198,11 +355,30 @@ NS_SWIFT_NAME(PagingView)
 /// Returns all of the currently visible pages as an un-ordered set
 - (nullable NSSet<__kindof UIView<TOPagingViewPage> *> *)visiblePageViews;
 
-/// Returns the visible page view for the supplied unique identifier, or nil otherwise.
+/// Returns all of the currently visible pages, ordered from the previous page to the next page.
+/// The array is cached and re-used until the visible pages change, so it is cheap to call every frame.
+- (NSArray<__kindof UIView<TOPagingViewPage> *> *)orderedVisiblePageViews;
+
+/// Enumerates all of the currently visible pages, in order from the previous page to the next page.
+/// This does not allocate any memory, so it is safe to call every frame.
+/// - Parameter block: The block called for each visible page along with its type. Set `stop` to `YES` to end the enumeration.
+- (void)enumerateVisiblePageViewsUsingBlock:(void (NS_NOESCAPE ^)(__kindof UIView<TOPagingViewPage> *pageView,
+                                                                  TOPagingViewPageType type,
+                                                                  BOOL *stop))block
+                                            NS_SWIFT_NAME(enumerateVisiblePageViews(_:));
+
+/// Returns the page view for the supplied unique identifier, or nil otherwise.
+/// This includes recycled pages that are off-screen, but are still configured with their content and haven't been re-used yet.
+/// Returning one of these pages from the data source will show it again without it needing to be reconfigured.
 /// - Parameter identifier: The identifier of the specific page view to retrieve.
 - (nullable __kindof UIView<TOPagingViewPage> *)pageViewForUniqueIdentifier:(NSString *)identifier
                                                                             NS_SWIFT_NAME(uniquePageView(for:));
 
+/// When a snapshot store is set, call this once a page has finished displaying its content
+/// (eg, once its image has downloaded and been decoded) to remove its snapshot, and to let it be snapshotted in turn.
+/// - Parameter pageView: The page view that has finished loading.
+- (void)pageViewDidFinishLoadingContent:(UIView<TOPagingViewPage> *)pageView;
+
 /// Advance one page forward in ascending order (which will be left or right depending on direction)
 /// - Parameter animated: Whether the transition is animated, or updates instantly
 - (void)turnToNextPageAnimated:(BOOL)animated;
@@ -220,15 +396,61 @@ NS_SWIFT_NAME(PagingView)
 - (void)turnToRightPageAnimated:(BOOL)animated;
 
 /// Skips ahead to an arbitrary new page view.
-/// The data source must be updated to the new state before calling this.
+/// The data source must be updated to the new state before calling this. If this paging view is linked to a coordinator,
+/// the skip is mirrored in every linked paging view straight away, so all of their data sources must be updated first too.
 /// - Parameter animated: Whether the transition is animated, or updates instantly
 - (void)skipForwardToNewPageAnimated:(BOOL)animated;
 
 /// Skips backwards to an arbitrary new page view.
-/// The data source must be updated to the new state before calling this.
+/// The data source must be updated to the new state before calling this. If this paging view is linked to a coordinator,
+/// the skip is mirrored in every linked paging view straight away, so all of their data sources must be updated first too.
 /// - Parameter animated: Whether the transition is animated, or updates instantly
 - (void)skipBackwardToNewPageAnimated:(BOOL)animated;
 
 @end
 
+//-------------------------------------------------------------------
+
+NS_SWIFT_NAME(PagingViewCoordinatorDelegate)
+@protocol TOPagingViewCoordinatorDelegate <NSObject>
+
+@optional
+
+/// Called just before the linked paging views request any pending pages from their data sources.
+/// All of the requests are made together in the same pass, so use this to batch any expensive data loading.
+/// @param coordinator The calling coordinator instance.
+- (void)pagingViewCoordinatorWillRequestPages:(TOPagingViewCoordinator *)coordinator;
+
+/// Called once all of the linked paging views have finished requesting their pending pages.
+/// @param coordinator The calling coordinator instance.
+- (void)pagingViewCoordinatorDidRequestPages:(TOPagingViewCoordinator *)coordinator;
+
+@end
+
+//-------------------------------------------------------------------
+
+/// An object that links several paging views together (eg, an original document and its translation),
+/// so that a page transition in any one of them drives all of the others in the same frame.
+/// Progress is mapped in terms of next and previous pages, so each paging view may have its own `pageScrollDirection`.
+/// The linked paging views can only scroll towards a page if every one of them has a page available in that direction.
+/// Skips are mirrored immediately, so update the data sources of every linked paging view before skipping any of them.
+NS_SWIFT_NAME(PagingViewCoordinator)
+@interface TOPagingViewCoordinator : NSObject
+
+/// The delegate informed when the linked paging views request their pages as a batch.
+@property (nonatomic, weak, nullable) id<TOPagingViewCoordinatorDelegate> delegate;
+
+/// All of the paging views currently linked to this coordinator. Paging views are not retained.
+@property (nonatomic, readonly) NSArray<TOPagingView *> *pagingViews;
+
+/// Links a paging view to this coordinator, removing it from any previous coordinator.
+/// - Parameter pagingView: The paging view to link.
+- (void)addPagingView:(TOPagingView *)pagingView;
+
+/// Unlinks a paging view from this coordinator.
+/// - Parameter pagingView: The paging view to unlink.
+- (void)removePagingView:(TOPagingView *)pagingView;
+
+@end
+
 NS_ASSUME_NONNULL_END
@@ -21,10 +21,17 @@
 //  IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #import "TOPagingView.h"
+#import <objc/runtime.h>
 
 /// Mark methods as being statically called to increase performance
 #define TOPAGINGVIEW_OBJC_DIRECT __attribute__((objc_direct))
 
+/// How to report any transition that makes more data source requests than its expected budget, on top of
+/// counting them in `metrics` (0 = Only count them, 1 = Log a warning, 2 = Assert). Opt in via the build settings.
+#ifndef TOPAGINGVIEW_DATA_SOURCE_BUDGET_MODE
+    #define TOPAGINGVIEW_DATA_SOURCE_BUDGET_MODE 0
+#endif
+
 // -----------------------------------------------------------------
 
 /// For pages that don't specify an identifier, this string will be used.
@@ -43,6 +50,69 @@ static const CGPoint kTOPagingViewAnimationControlPoint1 = (CGPoint){0.3f, 0.9f}
 static const CGPoint kTOPagingViewAnimationControlPoint2 = (CGPoint){0.45f, 1.0f};
 static const NSInteger kTOPagingViewAnimationOptions = (UIViewAnimationOptionAllowUserInteraction);
 
+/// Size changes closer together than this are treated as a live resize, which is only laid out once it has settled for this long.
+static const CFTimeInterval kTOPagingViewLiveResizeSettleInterval = 0.15f;
+
+/// The release velocity (in points per second) needed for a fling to carry past each page in momentum mode.
+static const CGFloat kTOPagingViewMomentumVelocityPerPage = 1500.0f;
+
+/// The most pages a single fling may travel in momentum mode.
+static const NSInteger kTOPagingViewMomentumMaximumPageCount = 10;
+
+/// The duration of a momentum fling animation, plus the additional time for each page travelled.
+static const CFTimeInterval kTOPagingViewMomentumBaseDuration = 0.3f;
+static const CFTimeInterval kTOPagingViewMomentumDurationPerPage = 0.05f;
+
+/// The range of times spent on a page that count towards the reading pace. Anything shorter is likely
+/// flicking through the pages, and anything longer is likely the user stepping away.
+static const CFTimeInterval kTOPagingViewReadingPaceMinimumDwellTime = 0.25f;
+static const CFTimeInterval kTOPagingViewReadingPaceMaximumDwellTime = 120.0f;
+
+/// How much weight each new page's dwell time has in the reading pace, and how many pages are needed before it's used.
+static const CGFloat kTOPagingViewReadingPaceSmoothingFactor = 0.3f;
+static const NSUInteger kTOPagingViewReadingPaceMinimumSampleCount = 3;
+
+/// How long before the predicted page turn that the adjacent pages are requested and prepared.
+static const CFTimeInterval kTOPagingViewReadingPaceLeadTime = 1.0f;
+
+// -----------------------------------------------------------------
+
+/// The three horizontal slots in the scroll view that pages may be placed in.
+/// Pages are mapped to slots depending on the current scroll direction.
+typedef NS_ENUM(NSInteger, TOPagingViewPageSlot) {
+    TOPagingViewPageSlotLeft = 0,
+    TOPagingViewPageSlotCenter = 1,
+    TOPagingViewPageSlotRight = 2
+};
+
+// -----------------------------------------------------------------
+
+/// The logical transitions that may request pages from the data source.
+typedef NS_ENUM(NSInteger, TOPagingViewTransition) {
+    TOPagingViewTransitionNone,
+    TOPagingViewTransitionInitialLayout,
+    TOPagingViewTransitionTurnToNextPage,
+    TOPagingViewTransitionTurnToPreviousPage,
+    TOPagingViewTransitionSkipToNewPage,
+    TOPagingViewTransitionReloadAdjacentPages,
+    TOPagingViewTransitionFetchAdjacentPages,
+    TOPagingViewTransitionRestoreAdjacentPages,
+    TOPagingViewTransitionCount
+};
+
+/// The most data source requests each transition is expected to make, including any
+/// requests deferred to later run-loop ticks. Any more than this means work is being duplicated.
+static const NSUInteger kTOPagingViewDataSourceBudget[TOPagingViewTransitionCount] = {
+    [TOPagingViewTransitionNone] = 0,
+    [TOPagingViewTransitionInitialLayout] = 3,        // The current, next and previous pages
+    [TOPagingViewTransitionTurnToNextPage] = 1,       // The new next page
+    [TOPagingViewTransitionTurnToPreviousPage] = 1,   // The new previous page
+    [TOPagingViewTransitionSkipToNewPage] = 3,        // The new current page, and both of its neighbours
+    [TOPagingViewTransitionReloadAdjacentPages] = 2,  // Both neighbours of the current page
+    [TOPagingViewTransitionFetchAdjacentPages] = 2,   // Any neighbours that were previously missing
+    [TOPagingViewTransitionRestoreAdjacentPages] = 2  // The neighbours released while in the background
+};
+
 // -----------------------------------------------------------------
 
 /// A struct to cache which methods the current delegate implements. */
@@ -50,8 +120,23 @@ typedef struct {
     unsigned int delegateWillTurnToPage:1;
     unsigned int delegateDidTurnToPage:1;
     unsigned int delegateDidChangeToPageDirection:1;
+    unsigned int delegateDidTurnPagesInBatch:1;
+    unsigned int delegateWillSkipToPageAtFraction:1;
+    unsigned int delegateWillSkipByNumberOfPages:1;
 } TOPagingViewDelegateFlags;
 
+/// A struct to cache the resolved implementations of the delegate and data source methods,
+/// so they can be called directly instead of going through message dispatch every time.
+typedef struct {
+    void (*willTurnToPage)(id, SEL, TOPagingView *, TOPagingViewPageType);
+    void (*didTurnToPage)(id, SEL, TOPagingView *, TOPagingViewPageType);
+    void (*didChangeToPageDirection)(id, SEL, TOPagingView *, TOPagingViewDirection);
+    void (*didTurnPagesInBatch)(id, SEL, TOPagingView *, TOPagingViewPageTurnBatch);
+    TOPagingViewPageType (*willSkipToPageAtFraction)(id, SEL, TOPagingView *, CGFloat);
+    NSInteger (*willSkipByNumberOfPages)(id, SEL, TOPagingView *, NSInteger);
+    UIView<TOPagingViewPage> *(*pageViewForType)(id, SEL, TOPagingView *, TOPagingViewPageType, UIView<TOPagingViewPage> *);
+} TOPagingViewDelegateIMPs;
+
 // -----------------------------------------------------------------
 
 /// A struct to cache which methods each page view class implements.
@@ -61,15 +146,55 @@ typedef struct {
     unsigned int protocolPrepareForReuse:1;
     unsigned int protocolIsInitialPage:1;
     unsigned int protocolSetPageDirection:1;
+    unsigned int protocolWillBecomeCurrentPage:1;
+    unsigned int protocolDidBecomeCurrentPage:1;
+    unsigned int protocolDidMoveToAdjacentSlot:1;
+    unsigned int protocolDidBecomeHidden:1;
 } TOPageViewProtocolFlags;
 
+/// A struct to cache the resolved implementations of the methods each page view class implements (NULL if not implemented).
+typedef struct {
+    NSString *(*uniqueIdentifier)(id, SEL);
+    void (*prepareForReuse)(id, SEL);
+    BOOL (*isInitialPage)(id, SEL);
+    void (*setPageDirection)(id, SEL, TOPagingViewDirection);
+    void (*willBecomeCurrentPage)(id, SEL);
+    void (*didBecomeCurrentPage)(id, SEL);
+    void (*didMoveToAdjacentSlot)(id, SEL);
+    void (*didBecomeHidden)(id, SEL);
+} TOPageViewProtocolIMPs;
+
+/// The points in a page's lifecycle that the page may be told about.
+typedef NS_ENUM(NSInteger, TOPagingViewPageLifecycleEvent) {
+    TOPagingViewPageLifecycleEventWillBecomeCurrent,
+    TOPagingViewPageLifecycleEventDidBecomeCurrent,
+    TOPagingViewPageLifecycleEventDidMoveToAdjacentSlot,
+    TOPagingViewPageLifecycleEventDidBecomeHidden
+};
+
 @interface TOPageViewProtocolCache : NSObject
 @property (nonatomic, assign) TOPageViewProtocolFlags flags;
+@property (nonatomic, assign) TOPageViewProtocolIMPs imps;
 @end
 
 @implementation TOPageViewProtocolCache
 @end
 
+// -----------------------------------------------------------------
+
+@interface TOPagingViewCoordinator ()
+
+/// All of the paging views linked to this coordinator, held weakly.
+@property (nonatomic, strong) NSHashTable<TOPagingView *> *linkedPagingViews;
+
+/// Set while one paging view is driving the others, to avoid feedback loops between them.
+@property (nonatomic, assign) BOOL isDrivingPagingViews;
+
+/// Set while the linked paging views are requesting their pending pages as a batch.
+@property (nonatomic, assign) BOOL isRequestingPages;
+
+@end
+
 // -----------------------------------------------------------------
 // Convenience functions for easier mapping Objective-C and C constructs
 
@@ -108,15 +233,53 @@ static inline Class TOPagingViewClassForValue(NSValue *value) {
 /// Struct to cache the state of the delegate for performance.
 @property (nonatomic, assign) TOPagingViewDelegateFlags delegateFlags;
 
+/// Struct to cache the method implementations of the delegate and data source, captured when each is assigned.
+@property (nonatomic, assign) TOPagingViewDelegateIMPs delegateIMPs;
+
 /// Struct to cache the protocol state of each type of page view class used in this session.
 @property (nonatomic, strong) NSMutableDictionary<NSString *, TOPageViewProtocolCache *> *pageViewProtocolFlags;
 
+/// The page view class that was most recently looked up, along with its cached protocol state. Since most
+/// sessions only use one or two page classes, this avoids looking the class up by name in the common case.
+@property (nonatomic, unsafe_unretained) Class lastPageViewClass;
+@property (nonatomic, assign) TOPageViewProtocolFlags lastPageViewProtocolFlags;
+@property (nonatomic, assign) TOPageViewProtocolIMPs lastPageViewProtocolIMPs;
+
 /// Disable automatic layout when manually laying out content.
 @property (nonatomic, assign) BOOL disableLayout;
 
-/// A dictionary that holds references to any pages with unique identifiers.
+/// The content inset used to gate the page slots, cached so it can be compared without querying the scroll view.
+/// Changes are staged here, and only written to the scroll view once per layout pass if they actually changed.
+@property (nonatomic, assign) UIEdgeInsets slotContentInset;
+@property (nonatomic, assign) BOOL needsSlotContentInsetUpdate;
+
+/// Counters of the work performed by this view.
+@property (nonatomic, assign, readwrite) TOPagingViewMetrics metrics;
+
+/// The transition currently in progress, and the number of data source requests it has made so far.
+@property (nonatomic, assign) TOPagingViewTransition currentTransition;
+@property (nonatomic, assign) NSUInteger currentTransitionRequestCount;
+
+/// Adjacent pages the data source has already confirmed are missing during the current transition.
+@property (nonatomic, assign) BOOL isNextPageConfirmedMissing;
+@property (nonatomic, assign) BOOL isPreviousPageConfirmedMissing;
+
+/// A dictionary that holds references to any visible or recycled pages with unique identifiers.
 @property (nonatomic, strong) NSMutableDictionary<NSString *, UIView *> *uniqueIdentifierPages;
 
+/// The unique identifier of each page, captured when it was last inserted.
+@property (nonatomic, strong) NSMapTable<UIView *, NSString *> *pageUniqueIdentifiers;
+
+/// Recycled pages that still hold their content, and need to be prepared before being re-used.
+@property (nonatomic, strong) NSHashTable<UIView *> *pagesPendingReuse;
+
+/// The snapshots covering pages that are still loading their content.
+@property (nonatomic, strong) NSMapTable<UIView *, UIImageView *> *snapshotOverlayViews;
+
+/// Pages that have finished loading their content since they were last re-used, and those waiting to be snapshotted.
+@property (nonatomic, strong) NSHashTable<UIView *> *pagesWithLoadedContent;
+@property (nonatomic, strong) NSHashTable<UIView *> *pagesPendingSnapshot;
+
 /// State tracking for when a user is dragging their finger on screen.
 @property (nonatomic, assign) CGFloat draggingOrigin;
 @property (nonatomic, assign) TOPagingViewPageType draggingDirectionType;
@@ -125,9 +288,82 @@ static inline Class TOPagingViewClassForValue(NSValue *value) {
 @property (nonatomic, assign) BOOL needsNextPage;
 @property (nonatomic, assign) BOOL needsPreviousPage;
 
+/// A copy of the resource policy's limits, refreshed whenever the policy changes.
+@property (nonatomic, assign) TOPagingViewResourceLimits resourceLimits;
+
+/// During a live resize, the snapshot standing in for the pages, and the time of the most recent size change.
+@property (nonatomic, strong, nullable) UIImageView *liveResizeSnapshotView;
+@property (nonatomic, assign) CFTimeInterval lastResizeTime;
+@property (nonatomic, assign) BOOL isLiveResizeSettleScheduled;
+
+/// After a live resize, the adjacent pages still need to be resized to match before they are scrolled into view.
+@property (nonatomic, assign) BOOL needsAdjacentPageResize;
+
+/// Which adjacent pages were released when the app entered the background, and need restoring in the foreground.
+@property (nonatomic, assign) BOOL needsNextPageRestore;
+@property (nonatomic, assign) BOOL needsPreviousPageRestore;
+
+/// A hidden view that recycled pages are parked in, keeping them out of the scroll view's subviews
+@property (nonatomic, strong) UIView *pooledPagesView;
+
 /// The animator used to play smooth transitions when turning pages
 @property (nonatomic, strong) UIViewPropertyAnimator *pageViewAnimator;
 
+/// During an animated skip, the old current page being animated out in one of the side slots.
+@property (nonatomic, weak) UIView<TOPagingViewPage> *outgoingPageView;
+
+/// During a snapshot based skip, the snapshot of the old current page being animated out.
+@property (nonatomic, weak) UIView *skipSnapshotView;
+
+/// While the user moves off the initial page when detecting the direction, a snapshot of the next page on the other side.
+@property (nonatomic, weak) UIView *mirroredNextPageView;
+
+/// When a momentum fling is about to skip, the number of pages it will travel.
+@property (nonatomic, assign) NSInteger momentumPageCount;
+
+/// A one-shot run loop observer used to perform deferred work the next time the main run loop goes idle.
+@property (nonatomic, assign) CFRunLoopObserverRef idleObserver;
+
+/// Set when the pages need to be told the page direction changed at the next idle point.
+@property (nonatomic, assign) BOOL needsPageDirectionUpdate;
+
+/// Set when newly fetched adjacent pages need to be laid out and displayed at the next idle point.
+@property (nonatomic, assign) BOOL needsNextPagePrewarm;
+@property (nonatomic, assign) BOOL needsPreviousPagePrewarm;
+
+/// The direction of the most recent page turn, used to decide which adjacent page to prepare first.
+@property (nonatomic, assign) TOPagingViewPageType lastTurnPageType;
+
+/// State tracking for estimating the reading pace. The time the current page became current, the number
+/// of dwell times that were measured, and the earliest time the adjacent pages should be prepared.
+@property (nonatomic, assign) CFTimeInterval currentPageStartTime;
+@property (nonatomic, assign) NSUInteger pageDwellSampleCount;
+@property (nonatomic, assign) CFTimeInterval pacedPrewarmTime;
+@property (nonatomic, assign) NSUInteger pacedPrewarmGeneration;
+
+/// Set while the pending adjacent pages are being held back until shortly before the predicted page turn,
+/// along with the time they will be requested, and the schedule that will request them.
+@property (nonatomic, assign) BOOL isHoldingPendingPages;
+@property (nonatomic, assign) CFTimeInterval pacedPageRequestTime;
+@property (nonatomic, assign) NSUInteger pacedPageRequestGeneration;
+
+/// The keyboard commands this view responds to, built once on first request.
+@property (nonatomic, copy, nullable) NSArray<UIKeyCommand *> *cachedKeyCommands;
+
+/// When batching is enabled, the page turns accumulated since the last batch was delivered to the delegate.
+@property (nonatomic, assign) TOPagingViewPageTurnBatch pendingPageTurnBatch;
+
+/// The coordinator that this paging view is linked with, if any.
+@property (nonatomic, weak, readwrite) TOPagingViewCoordinator *coordinator;
+
+/// A cached, ordered array of the visible pages, along with the pages it was built from
+/// so we can tell when it needs to be rebuilt without needing to track every slot change.
+/// It is dropped whenever a page leaves the slots, so it never keeps a released page alive.
+@property (nonatomic, copy) NSArray<UIView<TOPagingViewPage> *> *orderedVisiblePageViews;
+@property (nonatomic, unsafe_unretained) UIView *orderedPreviousPageView;
+@property (nonatomic, unsafe_unretained) UIView *orderedCurrentPageView;
+@property (nonatomic, unsafe_unretained) UIView *orderedNextPageView;
+
 @end
 
 // -----------------------------------------------------------------
@@ -162,18 +398,50 @@ static inline Class TOPagingViewClassForValue(NSValue *value) {
     // Set default values
     _pageSpacing = 40.0f;
     _queuedPages = [NSMutableDictionary dictionary];
+    _pageUniqueIdentifiers = [NSMapTable weakToStrongObjectsMapTable];
+    _pagesPendingReuse = [NSHashTable weakObjectsHashTable];
+    _snapshotOverlayViews = [NSMapTable weakToStrongObjectsMapTable];
+    _pagesWithLoadedContent = [NSHashTable weakObjectsHashTable];
+    _pagesPendingSnapshot = [NSHashTable weakObjectsHashTable];
     _pageViewProtocolFlags = [NSMutableDictionary dictionary];
     memset(&_delegateFlags, 0, sizeof(TOPagingViewDelegateFlags));
+    memset(&_pendingPageTurnBatch, 0, sizeof(TOPagingViewPageTurnBatch));
+    memset(&_delegateIMPs, 0, sizeof(TOPagingViewDelegateIMPs));
+    memset(&_metrics, 0, sizeof(TOPagingViewMetrics));
 
     // Configure the main properties of this view
     self.clipsToBounds = YES; // The scroll view intentionally overlaps, so this view MUST clip.
     self.backgroundColor = [UIColor clearColor];
     
+    // Create the container for recycled pages. Pages are re-parented rather than removed from the
+    // hierarchy so they stay in the window and don't need to tear down and rebuild their content.
+    _pooledPagesView = [[UIView alloc] initWithFrame:CGRectZero];
+    _pooledPagesView.hidden = YES;
+    _pooledPagesView.userInteractionEnabled = NO;
+    [self addSubview:_pooledPagesView];
+
     // Create and configure the scroll view
     _scrollView = [[UIScrollView alloc] initWithFrame:CGRectZero];
     [self _configureScrollView];
     [self addSubview:_scrollView];
 
+    // Apply the default resource policy, and track any changes to it
+    [self setResourcePolicy:nil];
+
+    // Release memory while the app is in the background
+    NSNotificationCenter *const notificationCenter = [NSNotificationCenter defaultCenter];
+    [notificationCenter addObserver:self
+                           selector:@selector(_applicationDidEnterBackground:)
+                               name:UIApplicationDidEnterBackgroundNotification
+                             object:nil];
+    [notificationCenter addObserver:self
+                           selector:@selector(_applicationWillEnterForeground:)
+                               name:UIApplicationWillEnterForegroundNotification
+                             object:nil];
+
+    // Observe the end of each drag to check for momentum flings
+    [_scrollView.panGestureRecognizer addTarget:self action:@selector(_scrollViewPanGestureRecognized:)];
+
     // Configure the page view animator
     UICubicTimingParameters *const cubicTiming = [[UICubicTimingParameters alloc] initWithControlPoint1:kTOPagingViewAnimationControlPoint1
                                                                                     controlPoint2:kTOPagingViewAnimationControlPoint2];
@@ -220,6 +488,12 @@ static inline Class TOPagingViewClassForValue(NSValue *value) {
 {
     // Make sure to remove the observer before we deallocate otherwise it can potentially cause a crash.
     [_scrollView removeObserver:self forKeyPath:@"contentOffset"];
+
+    // Tear down any pending idle work
+    if (_idleObserver != NULL) {
+        CFRunLoopObserverInvalidate(_idleObserver);
+        CFRelease(_idleObserver);
+    }
 }
 
 #pragma mark - View Lifecycle -
@@ -240,9 +514,8 @@ static inline Class TOPagingViewClassForValue(NSValue *value) {
 - (void)layoutContent
 {
     // If need be, request new next/previous pages
-    [self _requestPendingPages];
+    TOPagingViewRequestPendingPages(self);
 
-    UIScrollView *const scrollView = _scrollView;
     const CGRect newScrollViewFrame = TOPagingViewScrollViewFrame(self);
 
     // We don't need to perform any new sizing calculations unless the frame changed enough to warrant
@@ -251,6 +524,19 @@ static inline Class TOPagingViewClassForValue(NSValue *value) {
         return;
     }
 
+    // During a live resize, stretch a snapshot instead, and only lay out the pages once the size settles
+    if (_isLiveResizeDeferralEnabled && TOPagingViewDeferLiveResize(self)) {
+        return;
+    }
+
+    [self _resizeContentDeferringAdjacentPages:NO];
+}
+
+- (void)_resizeContentDeferringAdjacentPages:(BOOL)deferAdjacentPages TOPAGINGVIEW_OBJC_DIRECT
+{
+    UIScrollView *const scrollView = _scrollView;
+    const CGRect newScrollViewFrame = TOPagingViewScrollViewFrame(self);
+
     // Disable the observer while we update the scroll view
     _disableLayout = YES;
     
@@ -277,10 +563,109 @@ static inline Class TOPagingViewClassForValue(NSValue *value) {
     // Re-enable the observer
     _disableLayout = NO;
 
-    // Layout the page subviews
-    _nextPageView.frame = TOPagingViewNextPageFrame(self);
+    // Layout the page subviews, leaving the off-screen ones until later if requested
     _currentPageView.frame = TOPagingViewCurrentPageFrame(self);
-    _previousPageView.frame = TOPagingViewPreviousPageFrame(self);
+    if (deferAdjacentPages) {
+        _needsAdjacentPageResize = YES;
+        TOPagingViewScheduleIdleWork(self);
+    } else {
+        TOPagingViewResizeAdjacentPages(self);
+    }
+}
+
+static inline void TOPagingViewResizeAdjacentPages(TOPagingView *view)
+{
+    // Recycled pages don't need resizing, since their frames are set again when they are re-inserted
+    view->_needsAdjacentPageResize = NO;
+    view->_nextPageView.frame = TOPagingViewNextPageFrame(view);
+    view->_previousPageView.frame = TOPagingViewPreviousPageFrame(view);
+}
+
+static BOOL TOPagingViewDeferLiveResize(TOPagingView *view)
+{
+    const CFTimeInterval now = CACurrentMediaTime();
+    UIImageView *const liveResizeSnapshotView = view->_liveResizeSnapshotView;
+
+    // If already live resizing, stretch the snapshot to any new size, and check back once the size has stopped changing.
+    // (The snapshot is sized explicitly, so it holds the last size seen. Layout passes that didn't change it don't count.)
+    if (liveResizeSnapshotView != nil) {
+        if (!CGSizeEqualToSize(liveResizeSnapshotView.frame.size, view.bounds.size)) {
+            view->_lastResizeTime = now;
+            liveResizeSnapshotView.frame = view.bounds;
+        }
+        TOPagingViewScheduleLiveResizeSettleCheck(view, kTOPagingViewLiveResizeSettleInterval);
+        return YES;
+    }
+
+    // Start a live resize if this change came soon after the last one, and nothing else is moving the pages
+    const BOOL isContinuous = (now - view->_lastResizeTime) < kTOPagingViewLiveResizeSettleInterval;
+    view->_lastResizeTime = now;
+
+    UIScrollView *const scrollView = view->_scrollView;
+    const BOOL isTransitioning = view->_disableLayout || view->_pageViewAnimator.isRunning
+                                    || scrollView.isTracking || scrollView.isDecelerating
+                                    || view->_outgoingPageView != nil || view->_skipSnapshotView != nil;
+    UIView *const currentPageView = view->_currentPageView;
+    if (!isContinuous || isTransitioning || currentPageView == nil || CGRectIsEmpty(currentPageView.bounds)) { return NO; }
+
+    // Capture the current page as it is now, and hide the real pages behind it
+    UIGraphicsImageRenderer *const renderer = [[UIGraphicsImageRenderer alloc] initWithBounds:currentPageView.bounds];
+    UIImage *const snapshot = [renderer imageWithActions:^(UIGraphicsImageRendererContext *context) {
+        [currentPageView drawViewHierarchyInRect:currentPageView.bounds afterScreenUpdates:NO];
+    }];
+    UIImageView *const snapshotView = [[UIImageView alloc] initWithImage:snapshot];
+    snapshotView.contentMode = UIViewContentModeScaleAspectFill;
+    snapshotView.clipsToBounds = YES;
+    snapshotView.frame = view.bounds;
+    [view addSubview:snapshotView];
+    view->_liveResizeSnapshotView = snapshotView;
+    scrollView.hidden = YES;
+
+    TOPagingViewScheduleLiveResizeSettleCheck(view, kTOPagingViewLiveResizeSettleInterval);
+    return YES;
+}
+
+static void TOPagingViewScheduleLiveResizeSettleCheck(TOPagingView *view, CFTimeInterval delay)
+{
+    if (view->_isLiveResizeSettleScheduled) { return; }
+    view->_isLiveResizeSettleScheduled = YES;
+
+    __weak TOPagingView *weakView = view;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+        TOPagingView *const strongView = weakView;
+        if (strongView == nil) { return; }
+        strongView->_isLiveResizeSettleScheduled = NO;
+        if (strongView->_liveResizeSnapshotView == nil) { return; }
+
+        // If the size changed again in the meantime, wait out the rest of the interval
+        const CFTimeInterval elapsed = CACurrentMediaTime() - strongView->_lastResizeTime;
+        if (elapsed < kTOPagingViewLiveResizeSettleInterval) {
+            TOPagingViewScheduleLiveResizeSettleCheck(strongView, kTOPagingViewLiveResizeSettleInterval - elapsed);
+            return;
+        }
+        TOPagingViewEndLiveResize(strongView, YES);
+    });
+}
+
+static void TOPagingViewEndLiveResize(TOPagingView *view, BOOL deferAdjacentPages)
+{
+    // Swap the snapshot back out for the real pages
+    [view->_liveResizeSnapshotView removeFromSuperview];
+    view->_liveResizeSnapshotView = nil;
+    view->_scrollView.hidden = NO;
+
+    // Once settled, only the current page needs to be laid out for the next frame
+    [view _resizeContentDeferringAdjacentPages:deferAdjacentPages];
+}
+
+static void TOPagingViewFinishLiveResize(TOPagingView *view)
+{
+    // Turns and skips move the real pages straight away, so they must be visible, and all at the new size
+    if (view->_liveResizeSnapshotView != nil) {
+        TOPagingViewEndLiveResize(view, NO);
+    } else if (view->_needsAdjacentPageResize) {
+        TOPagingViewResizeAdjacentPages(view);
+    }
 }
 
 - (void)didMoveToSuperview
@@ -373,6 +758,9 @@ static inline Class TOPagingViewClassForValue(NSValue *value) {
     
     // If a page was found, set its bounds, and return it
     if (pageView) {
+        // If the page still holds its previous content, remove it from the index and clean it up now
+        TOPagingViewPreparePageViewForReuse(self, pageView);
+
         if (!CGSizeEqualToSize(pageView.frame.size, self.bounds.size)) {
             pageView.frame = self.bounds;
         }
@@ -404,60 +792,163 @@ static inline NSString *TOPagingViewIdentifierForPageViewClass(TOPagingView *vie
 static inline BOOL TOPagingViewIsInitialPageForPageView(TOPagingView *view, UIView<TOPagingViewPage> *pageView)
 {
     if (pageView == nil) { return NO; }
-    TOPageViewProtocolFlags flags = TOPagingViewCachedProtocolFlagsForPageViewClass(view, pageView.class);
-    return flags.protocolIsInitialPage ? [pageView isInitialPage] : NO;
+    const TOPageViewProtocolIMPs imps = TOPagingViewCachedProtocolIMPsForPageView(view, pageView);
+    return imps.isInitialPage ? imps.isInitialPage(pageView, @selector(isInitialPage)) : NO;
 }
 
 static inline void TOPagingViewSetPageDirectionForPageView(TOPagingView *view, TOPagingViewDirection direction, UIView<TOPagingViewPage> *pageView)
 {
     if (pageView == nil) { return; }
-    TOPageViewProtocolFlags flags = TOPagingViewCachedProtocolFlagsForPageViewClass(view, pageView.class);
-    if (flags.protocolSetPageDirection) { [pageView setPageDirection:direction]; }
+    const TOPageViewProtocolIMPs imps = TOPagingViewCachedProtocolIMPsForPageView(view, pageView);
+    if (imps.setPageDirection) { imps.setPageDirection(pageView, @selector(setPageDirection:), direction); }
+}
+
+static inline void TOPagingViewUpdatePageLoaderForLifecycleEvent(TOPagingView *view, TOPagingViewPageLifecycleEvent event, UIView *pageView)
+{
+    TOPagingViewPageLoader *const pageLoader = view->_pageLoader;
+    if (pageLoader == nil) { return; }
+
+    // Keep the page's requests in step with the slot it is in, and cancel them once it has been recycled
+    switch (event) {
+        case TOPagingViewPageLifecycleEventWillBecomeCurrent:
+            [pageLoader setDistance:0 forOwner:pageView];
+            break;
+        case TOPagingViewPageLifecycleEventDidMoveToAdjacentSlot:
+            [pageLoader setDistance:1 forOwner:pageView];
+            break;
+        case TOPagingViewPageLifecycleEventDidBecomeHidden:
+            [pageLoader cancelRequestsForOwner:pageView];
+            break;
+        case TOPagingViewPageLifecycleEventDidBecomeCurrent:
+            break;
+    }
+}
+
+static inline void TOPagingViewSendLifecycleEventToPageView(TOPagingView *view, TOPagingViewPageLifecycleEvent event, UIView *pageView)
+{
+    if (pageView == nil) { return; }
+    TOPagingViewUpdatePageLoaderForLifecycleEvent(view, event, pageView);
+    const TOPageViewProtocolIMPs imps = TOPagingViewCachedProtocolIMPsForPageView(view, pageView);
+    switch (event) {
+        case TOPagingViewPageLifecycleEventWillBecomeCurrent:
+            if (imps.willBecomeCurrentPage) { imps.willBecomeCurrentPage(pageView, @selector(willBecomeCurrentPage)); }
+            break;
+        case TOPagingViewPageLifecycleEventDidBecomeCurrent:
+            if (imps.didBecomeCurrentPage) { imps.didBecomeCurrentPage(pageView, @selector(didBecomeCurrentPage)); }
+            break;
+        case TOPagingViewPageLifecycleEventDidMoveToAdjacentSlot:
+            if (imps.didMoveToAdjacentSlot) { imps.didMoveToAdjacentSlot(pageView, @selector(didMoveToAdjacentSlot)); }
+            break;
+        case TOPagingViewPageLifecycleEventDidBecomeHidden:
+            if (imps.didBecomeHidden) { imps.didBecomeHidden(pageView, @selector(didBecomeHidden)); }
+            break;
+    }
 }
 
 static inline TOPageViewProtocolFlags TOPagingViewCachedProtocolFlagsForPageViewClass(TOPagingView *view, Class class)
 {
-    // Skip if we already captured the protocols from this class
-    TOPageViewProtocolCache *cache = view->_pageViewProtocolFlags[NSStringFromClass(class)];
-    if (cache != nil) { return cache.flags; }
+    TOPagingViewCacheProtocolForPageViewClass(view, class);
+    return view->_lastPageViewProtocolFlags;
+}
 
-    // Create a new instance of the struct and prepare its memory
-    TOPageViewProtocolFlags flags;
-    memset(&flags, 0, sizeof(TOPageViewProtocolFlags));
+static inline TOPageViewProtocolIMPs TOPagingViewCachedProtocolIMPsForPageView(TOPagingView *view, UIView *pageView)
+{
+    TOPagingViewCacheProtocolForPageViewClass(view, object_getClass(pageView));
+    return view->_lastPageViewProtocolIMPs;
+}
 
-    // Capture the protocol methods this class implements
-    flags.protocolPageIdentifier = [class respondsToSelector:@selector(pageIdentifier)];
-    flags.protocolUniqueIdentifier = [class instancesRespondToSelector:@selector(uniqueIdentifier)];
-    flags.protocolPrepareForReuse = [class instancesRespondToSelector:@selector(prepareForReuse)];
-    flags.protocolIsInitialPage = [class instancesRespondToSelector:@selector(isInitialPage)];
-    flags.protocolSetPageDirection = [class instancesRespondToSelector:@selector(setPageDirection:)];
+static inline IMP TOPagingViewInstanceMethodForSelector(Class class, SEL selector)
+{
+    return [class instancesRespondToSelector:selector] ? class_getMethodImplementation(class, selector) : NULL;
+}
 
-    // Store in the dictionary
-    cache = [TOPageViewProtocolCache new];
-    cache.flags = flags;
-    view->_pageViewProtocolFlags[NSStringFromClass(class)] = cache;
+static void TOPagingViewCacheProtocolForPageViewClass(TOPagingView *view, Class class)
+{
+    // Skip if this is the same class as last time
+    if (class == view->_lastPageViewClass) { return; }
 
-    // Return the flags
-    return flags;
+    // Skip if we already captured the protocols from this class
+    TOPageViewProtocolCache *cache = view->_pageViewProtocolFlags[NSStringFromClass(class)];
+    if (cache == nil) {
+        // Create a new instance of the struct and prepare its memory
+        TOPageViewProtocolFlags flags;
+        memset(&flags, 0, sizeof(TOPageViewProtocolFlags));
+
+        // Capture the protocol methods this class implements
+        flags.protocolPageIdentifier = [class respondsToSelector:@selector(pageIdentifier)];
+        flags.protocolUniqueIdentifier = [class instancesRespondToSelector:@selector(uniqueIdentifier)];
+        flags.protocolPrepareForReuse = [class instancesRespondToSelector:@selector(prepareForReuse)];
+        flags.protocolIsInitialPage = [class instancesRespondToSelector:@selector(isInitialPage)];
+        flags.protocolSetPageDirection = [class instancesRespondToSelector:@selector(setPageDirection:)];
+        flags.protocolWillBecomeCurrentPage = [class instancesRespondToSelector:@selector(willBecomeCurrentPage)];
+        flags.protocolDidBecomeCurrentPage = [class instancesRespondToSelector:@selector(didBecomeCurrentPage)];
+        flags.protocolDidMoveToAdjacentSlot = [class instancesRespondToSelector:@selector(didMoveToAdjacentSlot)];
+        flags.protocolDidBecomeHidden = [class instancesRespondToSelector:@selector(didBecomeHidden)];
+
+        // Resolve the implementations of those methods so they can be called directly
+        TOPageViewProtocolIMPs imps;
+        imps.uniqueIdentifier = (__typeof__(imps.uniqueIdentifier))TOPagingViewInstanceMethodForSelector(class, @selector(uniqueIdentifier));
+        imps.prepareForReuse = (__typeof__(imps.prepareForReuse))TOPagingViewInstanceMethodForSelector(class, @selector(prepareForReuse));
+        imps.isInitialPage = (__typeof__(imps.isInitialPage))TOPagingViewInstanceMethodForSelector(class, @selector(isInitialPage));
+        imps.setPageDirection = (__typeof__(imps.setPageDirection))TOPagingViewInstanceMethodForSelector(class, @selector(setPageDirection:));
+        imps.willBecomeCurrentPage = (__typeof__(imps.willBecomeCurrentPage))TOPagingViewInstanceMethodForSelector(class, @selector(willBecomeCurrentPage));
+        imps.didBecomeCurrentPage = (__typeof__(imps.didBecomeCurrentPage))TOPagingViewInstanceMethodForSelector(class, @selector(didBecomeCurrentPage));
+        imps.didMoveToAdjacentSlot = (__typeof__(imps.didMoveToAdjacentSlot))TOPagingViewInstanceMethodForSelector(class, @selector(didMoveToAdjacentSlot));
+        imps.didBecomeHidden = (__typeof__(imps.didBecomeHidden))TOPagingViewInstanceMethodForSelector(class, @selector(didBecomeHidden));
+
+        // Store in the dictionary
+        cache = [TOPageViewProtocolCache new];
+        cache.flags = flags;
+        cache.imps = imps;
+        view->_pageViewProtocolFlags[NSStringFromClass(class)] = cache;
+    }
+
+    // Promote to the most recently used class
+    view->_lastPageViewClass = class;
+    view->_lastPageViewProtocolFlags = cache.flags;
+    view->_lastPageViewProtocolIMPs = cache.imps;
 }
 
 #pragma mark - External Page Control -
 
 - (void)reload
 {
-    // Remove all currently visible pages from the scroll views
-    for (UIView *view in _scrollView.subviews) {
-        TOPagingViewReclaimPageView(self, view);
-        [view removeFromSuperview];
+    TOPagingViewPublishEvent(self, TOPagingViewEventTypeReload, 0);
+    _currentPageStartTime = CACurrentMediaTime();
+
+    // Remove all of the pages in the slots, along with any skip animation still in progress
+    TOPagingViewSendLifecycleEventToPageView(self, TOPagingViewPageLifecycleEventDidBecomeHidden, _currentPageView);
+    TOPagingViewSendLifecycleEventToPageView(self, TOPagingViewPageLifecycleEventDidBecomeHidden, _nextPageView);
+    TOPagingViewSendLifecycleEventToPageView(self, TOPagingViewPageLifecycleEventDidBecomeHidden, _previousPageView);
+    TOPagingViewSendLifecycleEventToPageView(self, TOPagingViewPageLifecycleEventDidBecomeHidden, _outgoingPageView);
+    [_currentPageView removeFromSuperview];
+    [_nextPageView removeFromSuperview];
+    [_previousPageView removeFromSuperview];
+    [_outgoingPageView removeFromSuperview];
+    [_skipSnapshotView removeFromSuperview];
+    TOPagingViewRemoveMirroredNextPage(self);
+
+    // Remove all of the recycled pages
+    for (UIView *pageView in _pooledPagesView.subviews) {
+        [pageView removeFromSuperview];
     }
 
     // Reset all of the active page references
     _currentPageView = nil;
     _previousPageView = nil;
     _nextPageView = nil;
+    _needsNextPageRestore = NO;
+    _needsPreviousPageRestore = NO;
     
-    // Clean out all of the pages in the queues
+    // Clean out all of the pages in the queues, along with their identifiers and snapshots
     [_queuedPages removeAllObjects];
+    [_pagesPendingReuse removeAllObjects];
+    for (UIImageView *snapshotView in _snapshotOverlayViews.objectEnumerator) { [snapshotView removeFromSuperview]; }
+    [_snapshotOverlayViews removeAllObjects];
+    [_pagesWithLoadedContent removeAllObjects];
+    [_pagesPendingSnapshot removeAllObjects];
+    [_pageUniqueIdentifiers removeAllObjects];
+    [_uniqueIdentifierPages removeAllObjects];
 
     // Reset the content size of the scroll view content
     TOPagingViewPerformBlockWithoutLayout(self, ^{
@@ -469,9 +960,12 @@ static inline TOPageViewProtocolFlags TOPagingViewCachedProtocolFlagsForPageView
 }
 
 - (void)reloadAdjacentPages {
+    TOPagingViewBeginTransition(self, TOPagingViewTransitionReloadAdjacentPages);
+
     // Reclaim the previous and next pages
     TOPagingViewReclaimPageView(self, _nextPageView);
     TOPagingViewReclaimPageView(self, _previousPageView);
+    TOPagingViewRemoveMirroredNextPage(self);
 
     _nextPageView = nil;
     _previousPageView = nil;
@@ -488,42 +982,58 @@ static inline TOPageViewProtocolFlags TOPagingViewCachedProtocolFlagsForPageView
 }
 
 - (void)fetchAdjacentPagesIfAvailable
+{
+    TOPagingViewBeginTransition(self, TOPagingViewTransitionFetchAdjacentPages);
+    [self _fetchAdjacentPagesIfAvailable];
+}
+
+- (void)_fetchAdjacentPagesIfAvailable TOPAGINGVIEW_OBJC_DIRECT
 {
     if (_dataSource == nil) { return; }
-    
-    // If there currently isn't a previous page, check again to see if there is one now.
-    if (!_hasPreviousPage) {
-        UIView<TOPagingViewPage> *previousPage = [_dataSource pagingView:self
-                                                         pageViewForType:TOPagingViewPageTypePrevious
-                                                         currentPageView:_currentPageView];
+
+    // When detecting the direction on the initial page, there is no previous page, only the next page
+    const BOOL isDetectingDirection = _isDynamicPageDirectionEnabled
+                                        && TOPagingViewIsInitialPageForPageView(self, _currentPageView);
+
+    // If there currently isn't a previous page, check again to see if there is one now
+    // (Unless the data source already confirmed there isn't one during this transition).
+    if (!_hasPreviousPage && !isDetectingDirection && !_isPreviousPageConfirmedMissing) {
+        UIView<TOPagingViewPage> *previousPage = TOPagingViewRequestPageView(self, TOPagingViewPageTypePrevious, _currentPageView);
+        _isPreviousPageConfirmedMissing = (previousPage == nil);
         // Add the page view to the hierarchy
         if (previousPage) {
             TOPagingViewInsertPageView(self, previousPage);
             previousPage.frame = TOPagingViewPreviousPageFrame(self);
             _previousPageView = previousPage;
             _hasPreviousPage = YES;
+            TOPagingViewSendLifecycleEventToPageView(self, TOPagingViewPageLifecycleEventDidMoveToAdjacentSlot, previousPage);
+            TOPagingViewSetNeedsPrewarmForPageType(self, TOPagingViewPageTypePrevious);
         }
     }
     
     // If there currently isn't a next page, check again
-    if (!_hasNextPage) {
-        UIView<TOPagingViewPage> *nextPage = [_dataSource pagingView:self
-                                                     pageViewForType:TOPagingViewPageTypeNext
-                                                     currentPageView:_currentPageView];
+    if (!_hasNextPage && !_isNextPageConfirmedMissing) {
+        UIView<TOPagingViewPage> *nextPage = TOPagingViewRequestPageView(self, TOPagingViewPageTypeNext, _currentPageView);
+        _isNextPageConfirmedMissing = (nextPage == nil);
         // Add the page view to the hierarchy
         if (nextPage) {
             TOPagingViewInsertPageView(self, nextPage);
             nextPage.frame = TOPagingViewNextPageFrame(self);
             _nextPageView = nextPage;
             _hasNextPage = YES;
+            TOPagingViewSendLifecycleEventToPageView(self, TOPagingViewPageLifecycleEventDidMoveToAdjacentSlot, nextPage);
+            TOPagingViewSetNeedsPrewarmForPageType(self, TOPagingViewPageTypeNext);
         }
     }
 
     // If we're on the initial page, set the previous page state to match whatever the next state is
-    if (_isDynamicPageDirectionEnabled && TOPagingViewIsInitialPageForPageView(self, _currentPageView)) {
+    if (isDetectingDirection) {
         _hasPreviousPage = _hasNextPage;
     }
 
+    // If linked, the other views may now be able to scroll towards this view's new pages
+    TOPagingViewUpdatePageSlotsOfLinkedPagingViews(self);
+
     [self _layoutPages];
 }
 
@@ -548,8 +1058,8 @@ static inline TOPageViewProtocolFlags TOPagingViewCachedProtocolFlagsForPageView
 - (void)turnToLeftPageAnimated:(BOOL)animated
 {
     const BOOL isDirectionReversed = TOPagingViewIsDirectionReversed(self);
-    const BOOL hasLeftPage = (isDirectionReversed && _hasNextPage) ||
-                             (!isDirectionReversed && _hasPreviousPage);
+    const BOOL hasLeftPage = (isDirectionReversed && TOPagingViewHasPageOfType(self, TOPagingViewPageTypeNext)) ||
+                             (!isDirectionReversed && TOPagingViewHasPageOfType(self, TOPagingViewPageTypePrevious));
 
     // Play a bouncy animation if there's no incoming page
     if (!hasLeftPage) {
@@ -565,8 +1075,8 @@ static inline TOPageViewProtocolFlags TOPagingViewCachedProtocolFlagsForPageView
 - (void)turnToRightPageAnimated:(BOOL)animated
 {
     const BOOL isDirectionReversed = TOPagingViewIsDirectionReversed(self);
-    const BOOL hasRightPage = (isDirectionReversed && _hasPreviousPage) ||
-                                (!isDirectionReversed && _hasNextPage);
+    const BOOL hasRightPage = (isDirectionReversed && TOPagingViewHasPageOfType(self, TOPagingViewPageTypePrevious)) ||
+                                (!isDirectionReversed && TOPagingViewHasPageOfType(self, TOPagingViewPageTypeNext));
 
     // Play a bouncy animation if there's no incoming page
     if (!hasRightPage) {
@@ -606,6 +1116,16 @@ static inline void TOPagingViewLayoutPages(TOPagingView *view) {
         return;
     }
 
+    // If the user starts dragging while the pending pages are being held for the reading pace, request them now
+    if (view->_isHoldingPendingPages && view->_scrollView.isTracking) {
+        TOPagingViewRequestPendingPages(view);
+    }
+
+    // After a live resize, make sure the adjacent pages match the new size before they can scroll into view
+    if (view->_needsAdjacentPageResize) {
+        TOPagingViewResizeAdjacentPages(view);
+    }
+
     // When dynamic paging is enabled, we swap the on-screen 'next' page to either
     // side of the initial page as the user swipes left and right
     if (view->_isDynamicPageDirectionEnabled 
@@ -613,6 +1133,12 @@ static inline void TOPagingViewLayoutPages(TOPagingView *view) {
         TOPagingViewHandleDynamicPageDirectionLayout(view);
     }
 
+    // If this view is linked to others, drive them to the same offset before any transitions
+    // happen, so they all cross the page threshold in the same frame.
+    if (view->_coordinator != nil) {
+        TOPagingViewSynchronizeLinkedPagingViews(view);
+    }
+
     // Check the offset of the scroll view, and when it passes over
     // the mid point between two pages, perform the page transition
     TOPagingViewHandlePageTransitions(view);
@@ -624,33 +1150,38 @@ static inline void TOPagingViewLayoutPages(TOPagingView *view) {
     // check if a page is ready or not and enable insetting at that point to
     // avoid any hitchy motion
     TOPagingViewUpdateEnabledPages(view);
+
+    // Write any inset changes from this pass to the scroll view in one go
+    TOPagingViewCommitSlotContentInset(view);
 }
 
 static inline void TOPagingViewPerformInitialLayout(TOPagingView *view)
 {
+    TOPagingViewBeginTransition(view, TOPagingViewTransitionInitialLayout);
+
     // Set these back to true for now, since we'll perform the check in here
     view->_hasNextPage = YES;
     view->_hasPreviousPage = YES;
 
     // Send a delegate event stating we're about to transition to the initial page
     if (view->_delegateFlags.delegateWillTurnToPage) {
-        [view->_delegate pagingView:view willTurnToPageOfType:TOPagingViewPageTypeCurrent];
+        TOPagingViewNotifyWillTurnToPage(view, TOPagingViewPageTypeCurrent);
     }
 
     // Add the initial page
-    UIView<TOPagingViewPage> *pageView = [view->_dataSource pagingView:view
-                                                       pageViewForType:TOPagingViewPageTypeCurrent
-                                                       currentPageView:nil];
+    UIView<TOPagingViewPage> *pageView = TOPagingViewRequestPageView(view, TOPagingViewPageTypeCurrent, nil);
     if (pageView == nil) { return; }
+    TOPagingViewSendLifecycleEventToPageView(view, TOPagingViewPageLifecycleEventWillBecomeCurrent, pageView);
     view->_currentPageView = pageView;
     TOPagingViewInsertPageView(view, pageView);
     view->_currentPageView.frame = TOPagingViewCurrentPageFrame(view);
+    TOPagingViewSendLifecycleEventToPageView(view, TOPagingViewPageLifecycleEventDidBecomeCurrent, pageView);
 
     // Add the next & previous pages
     [view _fetchNewNextPage];
 
     // When dynamic page detection is enabled, skip fetching the previous page, and assume we have one if we have
-    // a next page available.
+    // a next page available. A snapshot of the next page is shown on that side once the user starts moving.
     if (!view->_isDynamicPageDirectionEnabled || !TOPagingViewIsInitialPageForPageView(view, view->_currentPageView)) {
         [view _fetchNewPreviousPage];
     } else {
@@ -671,7 +1202,7 @@ static inline void TOPagingViewPerformInitialLayout(TOPagingView *view)
 
     // Send a delegate event stating we've completed transitioning to the initial page
     if (view->_delegateFlags.delegateDidTurnToPage) {
-        [view->_delegate pagingView:view didTurnToPageOfType:TOPagingViewPageTypeCurrent];
+        TOPagingViewNotifyDidTurnToPage(view, TOPagingViewPageTypeCurrent);
     }
 }
 
@@ -686,17 +1217,28 @@ static inline void TOPagingViewHandleDynamicPageDirectionLayout(TOPagingView *vi
 {
     const CGPoint offset = view->_scrollView.contentOffset;
     const CGFloat segmentWidth = TOPagingViewScrollViewPageWidth(view);
-    const UIView<TOPagingViewPage> *nextPage = view->_nextPageView;
-    const CGFloat xPosition = CGRectGetMinX(view->_nextPageView.frame);
 
-    // Check when the page starts moving in a certain direction and update the 'next'
-    // page to match if it hasn't already been updated.
-    if (offset.x < segmentWidth - FLT_EPSILON && xPosition > segmentWidth) {
-        TOPagingViewSetPageDirectionForPageView(view, TOPagingViewDirectionRightToLeft, view->_nextPageView);
-        nextPage.frame = TOPagingViewLeftPageFrame(view);
-    } else if (offset.x > segmentWidth + FLT_EPSILON && xPosition < segmentWidth) {
-        TOPagingViewSetPageDirectionForPageView(view, TOPagingViewDirectionLeftToRight, view->_nextPageView);
-        nextPage.frame = TOPagingViewRightPageFrame(view);
+    // As soon as the user moves off the initial page, show a snapshot of the next page on the other side,
+    // so wobbling between the two directions never moves or reconfigures the real next page.
+    // Drop it again once they settle back, so each new gesture shows the next page's latest content.
+    if (fabs(offset.x - segmentWidth) < FLT_EPSILON) {
+        TOPagingViewRemoveMirroredNextPage(view);
+    } else if (view->_mirroredNextPageView == nil) {
+        TOPagingViewInsertMirroredNextPage(view);
+    }
+
+    // If a snapshot of the next page couldn't be made, fall back to moving the
+    // single next page to whichever side the user starts moving towards.
+    if (view->_mirroredNextPageView == nil) {
+        const UIView<TOPagingViewPage> *nextPage = view->_nextPageView;
+        const CGFloat xPosition = CGRectGetMinX(view->_nextPageView.frame);
+        if (offset.x < segmentWidth - FLT_EPSILON && xPosition > segmentWidth) {
+            TOPagingViewSetPageDirectionForPageView(view, TOPagingViewDirectionRightToLeft, view->_nextPageView);
+            nextPage.frame = TOPagingViewLeftPageFrame(view);
+        } else if (offset.x > segmentWidth + FLT_EPSILON && xPosition < segmentWidth) {
+            TOPagingViewSetPageDirectionForPageView(view, TOPagingViewDirectionLeftToRight, view->_nextPageView);
+            nextPage.frame = TOPagingViewRightPageFrame(view);
+        }
     }
 
     // If we've sufficiently committed to this direction, update the hosting paging view's direction
@@ -711,8 +1253,21 @@ static inline void TOPagingViewHandleDynamicPageDirectionLayout(TOPagingView *vi
         needsDelegateUpdate = YES;
     }
 
-    if (needsDelegateUpdate && view->_delegateFlags.delegateDidChangeToPageDirection) {
-        [view->_delegate pagingView:view didChangeToPageDirection:view->_pageScrollDirection];
+    if (!needsDelegateUpdate) { return; }
+    TOPagingViewPublishEvent(view, TOPagingViewEventTypeDirectionChange, (int32_t)view->_pageScrollDirection);
+
+    // The user has fully committed to the side the snapshot is on, so swap the real next page in under it.
+    // This happens once, right before the page becomes current, rather than every time the user changes direction.
+    if (view->_mirroredNextPageView != nil) {
+        TOPagingViewSetPageDirectionForPageView(view, view->_pageScrollDirection, view->_nextPageView);
+        view->_nextPageView.frame = TOPagingViewNextPageFrame(view);
+        TOPagingViewRemoveMirroredNextPage(view);
+    }
+
+    if (view->_delegateFlags.delegateDidChangeToPageDirection) {
+        id const delegate = view->_delegate;
+        view->_delegateIMPs.didChangeToPageDirection(delegate, @selector(pagingView:didChangeToPageDirection:),
+                                                     view, view->_pageScrollDirection);
     }
 }
 
@@ -735,8 +1290,8 @@ static inline void TOPagingViewHandlePageTransitions(TOPagingView *view)
 
 static inline void TOPagingViewUpdateDragInteractions(TOPagingView *view)
 {
-    // Exit out if we don't actually use the delegate
-    if (view->_delegateFlags.delegateWillTurnToPage == NO) { return; }
+    // Exit out if we don't actually use the delegate (or need to share it with any linked views)
+    if (view->_delegateFlags.delegateWillTurnToPage == NO && view->_coordinator == nil) { return; }
 
     // If we're not being dragged, reset the state
     if (view->_scrollView.isTracking == NO) {
@@ -770,8 +1325,15 @@ static inline void TOPagingViewUpdateDragInteractions(TOPagingView *view)
     // If this is a new direction than before, inform the delegate, and then save to avoid repeating
     if (directionType != view->_draggingDirectionType) {
         // Offload this delegate call to another run-loop to avoid any heavy operations as the data source
-        [view->_delegate pagingView:view willTurnToPageOfType:directionType];
+        if (view->_delegateFlags.delegateWillTurnToPage) {
+            TOPagingViewNotifyWillTurnToPage(view, directionType);
+        }
         view->_draggingDirectionType = directionType;
+
+        // Share the prediction with any linked views so they can start preloading too
+        if (view->_coordinator != nil) {
+            TOPagingViewShareWillTurnWithLinkedPagingViews(view, directionType);
+        }
     }
 
     // Update with the new offset
@@ -788,10 +1350,10 @@ static inline void TOPagingViewUpdateEnabledPages(TOPagingView *view)
     BOOL isEnabled = NO;
     UIRectEdge edge = UIRectEdgeNone;
     if (offset.x < segmentWidth) { // Check the left page slot
-        isEnabled = isReversed ? view->_hasNextPage : view->_hasPreviousPage;
+        isEnabled = TOPagingViewHasPageOfType(view, isReversed ? TOPagingViewPageTypeNext : TOPagingViewPageTypePrevious);
         edge = UIRectEdgeLeft;
     } else if (offset.x > segmentWidth) { // Check the right slot
-        isEnabled = isReversed ? view->_hasPreviousPage : view->_hasNextPage;
+        isEnabled = TOPagingViewHasPageOfType(view, isReversed ? TOPagingViewPageTypePrevious : TOPagingViewPageTypeNext);
         edge = UIRectEdgeRight;
     }
 
@@ -806,38 +1368,70 @@ static inline void TOPagingViewSetPageSlotEnabled(TOPagingView *view, BOOL enabl
     // Fetch the segment width. It will be used for either value
     const CGFloat segmentWidth = TOPagingViewScrollViewPageWidth(view);
 
-    // Get the current insets of the scroll view
-    UIEdgeInsets insets = view->_scrollView.contentInset;
-
-    // Exit out if we don't need to set the state already
-    const BOOL isLeft = (edge == UIRectEdgeLeft);
-    CGFloat inset = isLeft ? insets.left : insets.right;
-    if (enabled && inset == segmentWidth) { return; }
-    else if (!enabled && inset == -segmentWidth) { return; }
-
     // When the slot is enabled, expand the scrollable region an
     // extra slot, so that it won't bump against the edge of the
     // scroll region when scrolling rapidly.
     // Otherwise, inset it a whole slot to disable it completely.
-    CGFloat value = enabled ? segmentWidth : -segmentWidth;
+    const CGFloat value = enabled ? segmentWidth : -segmentWidth;
 
-    // Capture the content offset since changing the inset will change it
-    CGPoint contentOffset = view->_scrollView.contentOffset;
+    // Exit out if the cached state already matches, without touching the scroll view
+    const BOOL isLeft = (edge == UIRectEdgeLeft);
+    UIEdgeInsets insets = view->_slotContentInset;
+    if ((isLeft ? insets.left : insets.right) == value) { return; }
 
-    // Set the target inset value
+    // Stage the new value. It will be written at the end of the layout pass.
     if (isLeft) { insets.left = value; }
     else { insets.right = value; }
+    view->_slotContentInset = insets;
+    view->_needsSlotContentInsetUpdate = YES;
+}
+
+static inline void TOPagingViewCommitSlotContentInset(TOPagingView *view)
+{
+    if (!view->_needsSlotContentInsetUpdate) { return; }
+    view->_needsSlotContentInsetUpdate = NO;
+
+    // Capture the content offset since changing the inset will change it
+    UIScrollView *const scrollView = view->_scrollView;
+    const CGPoint contentOffset = scrollView.contentOffset;
 
     // Set the inset and then restore the offset
     view->_disableLayout = YES;
-    view->_scrollView.contentInset = insets;
-    view->_scrollView.contentOffset = contentOffset;
+    scrollView.contentInset = view->_slotContentInset;
+    scrollView.contentOffset = contentOffset;
     view->_disableLayout = NO;
+
+    view->_metrics.contentInsetWriteCount++;
 }
 
 #pragma mark - Animated Transitions -
 
 - (void)_turnToPageInDirection:(UIRectEdge)direction animated:(BOOL)animated TOPAGINGVIEW_OBJC_DIRECT
+{
+    TOPagingViewFinishLiveResize(self);
+    TOPagingViewRequestHeldPendingPages(self);
+
+    // If this view isn't driving any linked views, perform the turn as normal
+    TOPagingViewCoordinator *const coordinator = _coordinator;
+    if (coordinator == nil || coordinator.isDrivingPagingViews) {
+        [self _performTurnToPageInDirection:direction animated:animated];
+        return;
+    }
+
+    // Perform the turn, and then mirror it in each linked view in terms of next/previous
+    // pages so it will still be correct if they are flowing in a different direction.
+    const BOOL isPreviousPage = (TOPagingViewPageTypeForEdge(self, direction) == TOPagingViewPageTypePrevious);
+    coordinator.isDrivingPagingViews = YES;
+    [self _performTurnToPageInDirection:direction animated:animated];
+    for (TOPagingView *linkedView in coordinator.linkedPagingViews) {
+        if (linkedView == self) { continue; }
+        if (isPreviousPage) { [linkedView turnToPreviousPageAnimated:animated]; }
+        else { [linkedView turnToNextPageAnimated:animated]; }
+    }
+    coordinator.isDrivingPagingViews = NO;
+}
+
+- (void)_performTurnToPageInDirection:(UIRectEdge)direction animated:(BOOL)animated TOPAGINGVIEW_OBJC_DIRECT
 {
     // Determine the direction to animate towards
     CGFloat offset = 0.0f;
@@ -848,17 +1442,12 @@ static inline void TOPagingViewSetPageSlotEnabled(TOPagingView *view, BOOL enabl
     UIScrollView *const scrollView = _scrollView;
 
     // Determine the direction we're heading for the delegate
-    const BOOL isLeftDirection = (offset < FLT_EPSILON);
-    const BOOL isDirectionReversed = TOPagingViewIsDirectionReversed(self);
-    const BOOL isDetectingDirection = _isDynamicPageDirectionEnabled
-                                        && TOPagingViewIsInitialPageForPageView(self, _currentPageView);
-    const BOOL isPreviousPage = !isDetectingDirection && ((!isDirectionReversed && isLeftDirection) ||
-                                                          (isDirectionReversed && !isLeftDirection));
+    const BOOL isPreviousPage = (TOPagingViewPageTypeForEdge(self, direction) == TOPagingViewPageTypePrevious);
 
     // Send a delegate event stating the page is about to turn
     if (_delegateFlags.delegateWillTurnToPage) {
         TOPagingViewPageType type = (isPreviousPage ? TOPagingViewPageTypePrevious : TOPagingViewPageTypeNext);
-        [_delegate pagingView:self willTurnToPageOfType:type];
+        TOPagingViewNotifyWillTurnToPage(self, type);
     }
 
     // If we're not animating, re-enable layout,
@@ -893,7 +1482,8 @@ static inline void TOPagingViewSetPageSlotEnabled(TOPagingView *view, BOOL enabl
     if (scrollView.layer.animationKeys.count) {
         // If we're already in an animation that is moving towards the last a page
         // with no page coming after it, cancel out to let the animation completely fluidly.
-        if ((isPreviousPage && !_hasPreviousPage) || (!isPreviousPage && !_hasNextPage)) {
+        if ((isPreviousPage && !TOPagingViewHasPageOfType(self, TOPagingViewPageTypePrevious)) ||
+            (!isPreviousPage && !TOPagingViewHasPageOfType(self, TOPagingViewPageTypeNext))) {
             return;
         }
 
@@ -953,6 +1543,29 @@ static inline void TOPagingViewSetPageSlotEnabled(TOPagingView *view, BOOL enabl
 }
 
 - (void)_skipToNewPageInDirection:(UIRectEdge)direction animated:(BOOL)animated TOPAGINGVIEW_OBJC_DIRECT
+{
+    TOPagingViewFinishLiveResize(self);
+
+    // If this view isn't driving any linked views, perform the skip as normal
+    TOPagingViewCoordinator *const coordinator = _coordinator;
+    if (coordinator == nil || coordinator.isDrivingPagingViews) {
+        [self _performSkipToNewPageInDirection:direction animated:animated];
+        return;
+    }
+
+    // Perform the skip, and then mirror it in each linked view, whose data sources must also already be updated
+    const BOOL isBackward = ((direction == UIRectEdgeLeft) != TOPagingViewIsDirectionReversed(self));
+    coordinator.isDrivingPagingViews = YES;
+    [self _performSkipToNewPageInDirection:direction animated:animated];
+    for (TOPagingView *linkedView in coordinator.linkedPagingViews) {
+        if (linkedView == self) { continue; }
+        if (isBackward) { [linkedView skipBackwardToNewPageAnimated:animated]; }
+        else { [linkedView skipForwardToNewPageAnimated:animated]; }
+    }
+    coordinator.isDrivingPagingViews = NO;
+}
+
+- (void)_performSkipToNewPageInDirection:(UIRectEdge)direction animated:(BOOL)animated TOPAGINGVIEW_OBJC_DIRECT
 {
     // Disable the layout since we'll handle everything beyond this point
     _disableLayout = YES;
@@ -967,14 +1580,31 @@ static inline void TOPagingViewSetPageSlotEnabled(TOPagingView *view, BOOL enabl
         [_scrollView.layer removeAllAnimations];
     }
 
-    // Reclaim the next and previous pages since these will always need to be regenerated
+    // If this skip is the result of a momentum fling, capture how things looked when the user let go
+    const NSInteger momentumPageCount = _momentumPageCount;
+    _momentumPageCount = 0;
+    UIView *const momentumSnapshotView = (animated && momentumPageCount > 1) ? [self snapshotViewAfterScreenUpdates:NO] : nil;
+
+    TOPagingViewBeginTransition(self, TOPagingViewTransitionSkipToNewPage);
+    const BOOL isSkippingBackward = (TOPagingViewPageTypeForEdge(self, direction) == TOPagingViewPageTypePrevious);
+    TOPagingViewPublishEvent(self, TOPagingViewEventTypeSkip, isSkippingBackward ? -1 : 1);
+    _currentPageStartTime = CACurrentMediaTime();
+
+    // Reclaim the next and previous pages since these will always need to be regenerated,
+    // as well as the outgoing page of any previous skip that was still animating
     TOPagingViewReclaimPageView(self, _nextPageView);
     TOPagingViewReclaimPageView(self, _previousPageView);
+    TOPagingViewReclaimPageView(self, _outgoingPageView);
+    _outgoingPageView = nil;
+
+    // Remove the snapshot of any previous skip that was still animating, and any mirror of the old next page
+    [_skipSnapshotView removeFromSuperview];
+    _skipSnapshotView = nil;
+    TOPagingViewRemoveMirroredNextPage(self);
+    _currentPageView.transform = CGAffineTransformIdentity;
 
     // Request the new page view that will become the new current page after this completes
-    UIView<TOPagingViewPage> *newPageView = [_dataSource pagingView:self
-                                                    pageViewForType:TOPagingViewPageTypeCurrent
-                                                    currentPageView:_currentPageView];
+    UIView<TOPagingViewPage> *newPageView = TOPagingViewRequestPageView(self, TOPagingViewPageTypeCurrent, _currentPageView);
 
     // Set the destination point regardless of animation to them middle
     CGPoint destinationPoint = (CGPoint){TOPagingViewScrollViewPageWidth(self), 0.0f}; // Destination is always the middle
@@ -992,9 +1622,11 @@ static inline void TOPagingViewSetPageSlotEnabled(TOPagingView *view, BOOL enabl
         TOPagingViewReclaimPageView(self, _currentPageView);
 
         // Insert the new current page view
+        TOPagingViewSendLifecycleEventToPageView(self, TOPagingViewPageLifecycleEventWillBecomeCurrent, newPageView);
         _currentPageView = newPageView;
         _currentPageView.frame = TOPagingViewCurrentPageFrame(self);
         TOPagingViewInsertPageView(self, _currentPageView);
+        TOPagingViewSendLifecycleEventToPageView(self, TOPagingViewPageLifecycleEventDidBecomeCurrent, newPageView);
 
         // Re-enable layout to trigger a check for the next pages
         _disableLayout = NO;
@@ -1003,8 +1635,21 @@ static inline void TOPagingViewSetPageSlotEnabled(TOPagingView *view, BOOL enabl
         _scrollView.contentOffset = destinationPoint;
 
         // Trigger requesting replacement adjacent pages
-        [self fetchAdjacentPagesIfAvailable];
+        [self _fetchAdjacentPagesIfAvailable];
+
+        return;
+    }
+
+    // If this was a momentum fling, animate through a strip of placeholders for the pages in between
+    if (momentumPageCount > 1) {
+        [self _performMomentumSkipToPageView:newPageView inDirection:direction
+                                snapshotView:momentumSnapshotView pageCount:momentumPageCount];
+        return;
+    }
 
+    // If a snapshot based style was chosen, animate a snapshot of the old page instead of scrolling
+    if (_skipTransitionStyle != TOPagingViewSkipTransitionStyleScroll) {
+        [self _performSnapshotSkipToPageView:newPageView inDirection:direction];
         return;
     }
 
@@ -1014,13 +1659,15 @@ static inline void TOPagingViewSetPageSlotEnabled(TOPagingView *view, BOOL enabl
     // Put the current view in the same slot so we can animate to the new one
     _currentPageView.frame = (direction == UIRectEdgeLeft) ? TOPagingViewRightPageFrame(self) : TOPagingViewLeftPageFrame(self);
 
-    // Make the old current page the previous page so we can keep track of it across animations
-    _previousPageView = _currentPageView;
+    // Keep track of the old current page across the animation, separately from the adjacent pages
+    _outgoingPageView = _currentPageView;
 
     // Put the new view in the center point and promote it to new current
+    TOPagingViewSendLifecycleEventToPageView(self, TOPagingViewPageLifecycleEventWillBecomeCurrent, newPageView);
     _currentPageView = newPageView;
     _currentPageView.frame = TOPagingViewCurrentPageFrame(self);
     TOPagingViewInsertPageView(self, _currentPageView);
+    TOPagingViewSendLifecycleEventToPageView(self, TOPagingViewPageLifecycleEventDidBecomeCurrent, newPageView);
 
     // Define the animation block, making sure not to cause any retain cycles
     __weak __typeof(self) weakSelf = self;
@@ -1035,15 +1682,17 @@ static inline void TOPagingViewSetPageSlotEnabled(TOPagingView *view, BOOL enabl
         __strong __typeof(weakSelf) strongSelf = weakSelf;
         if (!strongSelf) { return; }
 
-        // Remove the previous page
-        TOPagingViewReclaimPageView(self, self->_previousPageView);
-        strongSelf->_previousPageView = nil;
+        // Remove the outgoing page, and reveal any adjacent page that was loaded underneath it
+        TOPagingViewReclaimPageView(strongSelf, strongSelf->_outgoingPageView);
+        strongSelf->_outgoingPageView = nil;
+        strongSelf->_nextPageView.hidden = NO;
+        strongSelf->_previousPageView.hidden = NO;
 
         // Re-enable layout
         strongSelf->_disableLayout = NO;
 
-        // Trigger requesting replacement adjacent pages
-        [strongSelf fetchAdjacentPagesIfAvailable];
+        // Request any adjacent pages that weren't already loaded during the animation
+        [strongSelf _fetchAdjacentPagesIfAvailable];
 
         // If the scroll view delegate was set, tell it the animation completed
         id<UIScrollViewDelegate> scrollViewDelegate = strongSelf->_scrollView.delegate;
@@ -1058,110 +1707,477 @@ static inline void TOPagingViewSetPageSlotEnabled(TOPagingView *view, BOOL enabl
     [_pageViewAnimator addAnimations:animationBlock];
     [_pageViewAnimator addCompletion:completionBlock];
     [_pageViewAnimator startAnimation];
-}
 
-- (nullable __kindof UIView *)pageViewForUniqueIdentifier:(NSString *)identifier
-{
-    return _uniqueIdentifierPages[identifier];
+    // Rather than waiting for the animation to complete, request the destination's adjacent pages
+    // on the next run-loop tick, so they're ready by the time the animation lands on the new page.
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [weakSelf _fetchAdjacentPagesDuringSkip];
+    });
 }
 
-#pragma mark - Page View Recycling -
-
-static void TOPagingViewInsertPageView(TOPagingView *view, UIView<TOPagingViewPage> *pageView)
+- (void)_performSnapshotSkipToPageView:(UIView<TOPagingViewPage> *)newPageView
+                           inDirection:(UIRectEdge)direction TOPAGINGVIEW_OBJC_DIRECT
 {
-    if (pageView == nil) { return; }
+    // Capture how the old page currently looks, so it can be reclaimed straight away
+    UIView *const snapshotView = [_currentPageView snapshotViewAfterScreenUpdates:NO];
+    snapshotView.frame = self.bounds;
+    snapshotView.userInteractionEnabled = NO;
 
-    // Add the view to the scroll view
-    if (pageView.superview == nil) { [view->_scrollView addSubview:pageView]; }
-    pageView.hidden = NO;
-
-    // Cache the page's protocol methods if it hasn't been done yet
-    TOPageViewProtocolFlags flags = TOPagingViewCachedProtocolFlagsForPageViewClass(view, pageView.class);
+    // Swap in the new current page, and place the snapshot over the scroll view, so it stays put if the user drags
+    [self _replaceCurrentPageWithPageView:newPageView];
+    if (snapshotView) { [self addSubview:snapshotView]; }
+    _skipSnapshotView = snapshotView;
 
-    // If it has a unique identifier, store it so we can refer to it easily
-    if (flags.protocolUniqueIdentifier) {
-        NSString *uniqueIdentifier = [(id)pageView uniqueIdentifier];
+    // When sliding, the pages move in the same direction the scroll style would have scrolled them
+    const BOOL isSliding = (_skipTransitionStyle == TOPagingViewSkipTransitionStyleSlide);
+    const CGFloat slideOffset = TOPagingViewScrollViewPageWidth(self) * ((direction == UIRectEdgeLeft) ? 1.0f : -1.0f);
+    if (isSliding) { newPageView.transform = CGAffineTransformMakeTranslation(-slideOffset, 0.0f); }
 
-        // Lazily create the dictionary as needed
-        if (view->_uniqueIdentifierPages == nil) {
-            view->_uniqueIdentifierPages = [NSMutableDictionary dictionary];
+    // Define the animation block, making sure not to cause any retain cycles
+    __weak __typeof(self) weakSelf = self;
+    __weak UIView *weakPageView = newPageView;
+    id animationBlock = ^{
+        if (isSliding) {
+            snapshotView.transform = CGAffineTransformMakeTranslation(slideOffset, 0.0f);
+            weakPageView.transform = CGAffineTransformIdentity;
+        } else {
+            snapshotView.alpha = 0.0f;
         }
+    };
 
-        // Add to the dictionary
-        view->_uniqueIdentifierPages[uniqueIdentifier] = pageView;
-    }
-
-    // If the page view supports it, inform the delegate of the current page direction
-    if (flags.protocolSetPageDirection) {
-        [pageView setPageDirection:view->_pageScrollDirection];
-    }
+    // Define the completion block
+    id completionBlock = ^(UIViewAnimatingPosition finalPosition) {
+        __strong __typeof(weakSelf) strongSelf = weakSelf;
+        [snapshotView removeFromSuperview];
+        weakPageView.transform = CGAffineTransformIdentity;
+
+        // Only the new page is laid out during the transition, so request its adjacent pages now it has landed
+        // (Unless another skip has already taken over, in which case it requests its own)
+        if (strongSelf && strongSelf->_skipSnapshotView == snapshotView) {
+            strongSelf->_skipSnapshotView = nil;
+            [strongSelf _fetchAdjacentPagesIfAvailable];
+        }
+        TOPagingViewNotifyScrollViewDidEndScrollingAnimation(strongSelf);
+    };
 
-    // Remove it from the pool of recycled pages
-    NSString *pageIdentifier = TOPagingViewIdentifierForPageViewClass(view, pageView.class);
-    [view->_queuedPages[pageIdentifier] removeObject:pageView];
+    [_pageViewAnimator addAnimations:animationBlock];
+    [_pageViewAnimator addCompletion:completionBlock];
+    [_pageViewAnimator startAnimation];
 }
 
-static void TOPagingViewReclaimPageView(TOPagingView *view, UIView *pageView)
+- (void)_performMomentumSkipToPageView:(UIView<TOPagingViewPage> *)newPageView
+                           inDirection:(UIRectEdge)direction
+                          snapshotView:(nullable UIView *)snapshotView
+                             pageCount:(NSInteger)pageCount TOPAGINGVIEW_OBJC_DIRECT
 {
-    if (pageView == nil) { return; }
+    const CGRect bounds = self.bounds;
+    const CGFloat pageWidth = TOPagingViewScrollViewPageWidth(self);
+    const CGFloat edgeSign = (direction == UIRectEdgeRight) ? 1.0f : -1.0f;
 
-    // Skip internal UIScrollView views
-    if ([NSStringFromClass([pageView class]) characterAtIndex:0] == '_') {
-        return;
+    // Build a strip of everything being flung past; the snapshot of where the user let go, followed by a
+    // plain placeholder for each page in between. None of these need to be configured by the data source.
+    UIView *const stripView = [[UIView alloc] initWithFrame:bounds];
+    stripView.userInteractionEnabled = NO;
+    if (snapshotView) {
+        snapshotView.frame = bounds;
+        [stripView addSubview:snapshotView];
     }
 
-    // Fetch the protocol flags for this class
-    TOPageViewProtocolFlags flags = TOPagingViewCachedProtocolFlagsForPageViewClass(view, pageView.class);
-
-    // If the page has a unique identifier, remove it from the dictionary
-    if (flags.protocolUniqueIdentifier) {
-        [view->_uniqueIdentifierPages removeObjectForKey:[(id)pageView uniqueIdentifier]];
+    UIColor *const placeholderColor = _currentPageView.backgroundColor ?: self.backgroundColor;
+    for (NSInteger i = 1; i < pageCount; i++) {
+        UIView *const placeholderView = [[UIView alloc] initWithFrame:CGRectOffset(bounds, edgeSign * pageWidth * i, 0.0f)];
+        placeholderView.backgroundColor = placeholderColor;
+        [stripView addSubview:placeholderView];
     }
 
-    // If the class supports the clean up method, clean it up now
-    if (flags.protocolPrepareForReuse) {
-        [(id)pageView prepareForReuse];
-    }
+    // Swap in the landing page, and place the strip over the top of everything
+    [self _replaceCurrentPageWithPageView:newPageView];
+    [self addSubview:stripView];
+    _skipSnapshotView = stripView;
+    [self _fetchAdjacentPagesIfAvailable];
 
-    // Hide the view (Don't remove because that is a heavier operation)
-    pageView.hidden = YES;
+    // Start the landing page at the end of the strip, and move them both together
+    const CGFloat distance = edgeSign * pageWidth * pageCount;
+    newPageView.transform = CGAffineTransformMakeTranslation(distance, 0.0f);
 
-    // Re-add it to the recycled pages pool
-    NSString *pageIdentifier = TOPagingViewIdentifierForPageViewClass(view, pageView.class);
-    [view->_queuedPages[pageIdentifier] addObject:pageView];
+    __weak __typeof(self) weakSelf = self;
+    __weak UIView *weakPageView = newPageView;
+    const CFTimeInterval duration = kTOPagingViewMomentumBaseDuration + (kTOPagingViewMomentumDurationPerPage * pageCount);
+    UIViewPropertyAnimator *const animator = [[UIViewPropertyAnimator alloc] initWithDuration:duration
+                                                                                        curve:UIViewAnimationCurveEaseOut
+                                                                                   animations:^{
+        stripView.transform = CGAffineTransformMakeTranslation(-distance, 0.0f);
+        weakPageView.transform = CGAffineTransformIdentity;
+    }];
+    [animator addCompletion:^(UIViewAnimatingPosition finalPosition) {
+        __strong __typeof(weakSelf) strongSelf = weakSelf;
+        [stripView removeFromSuperview];
+        weakPageView.transform = CGAffineTransformIdentity;
+        if (strongSelf && strongSelf->_skipSnapshotView == stripView) { strongSelf->_skipSnapshotView = nil; }
+        TOPagingViewNotifyScrollViewDidEndScrollingAnimation(strongSelf);
+    }];
+    [animator startAnimation];
 }
 
-#pragma mark - Page Transitions -
+- (void)_replaceCurrentPageWithPageView:(UIView<TOPagingViewPage> *)newPageView TOPAGINGVIEW_OBJC_DIRECT
+{
+    // Reclaim the old current page straight away, and insert the new one in its place
+    TOPagingViewReclaimPageView(self, _currentPageView);
+    TOPagingViewSendLifecycleEventToPageView(self, TOPagingViewPageLifecycleEventWillBecomeCurrent, newPageView);
+    _currentPageView = newPageView;
+    _currentPageView.frame = TOPagingViewCurrentPageFrame(self);
+    TOPagingViewInsertPageView(self, _currentPageView);
+    TOPagingViewSendLifecycleEventToPageView(self, TOPagingViewPageLifecycleEventDidBecomeCurrent, newPageView);
 
-static inline void TOPagingViewTransitionOverToNextPage(TOPagingView *view)
+    // Since the scroll view itself doesn't move, layout can resume straight away.
+    // The caller requests the adjacent pages whenever suits its animation.
+    _disableLayout = NO;
+    _scrollView.contentOffset = (CGPoint){TOPagingViewScrollViewPageWidth(self), 0.0f};
+}
+
+static void TOPagingViewNotifyScrollViewDidEndScrollingAnimation(TOPagingView *view)
 {
-    // Don't start churning if we already confirmed there is no page after this.
-    if (!view->_hasNextPage) { return; }
+    if (view == nil) { return; }
 
-    // If we moved over to the threshold of the next page,
-    // re-enable the previous page
-    if (!view->_hasPreviousPage) {
-        view->_hasPreviousPage = YES;
+    // If the scroll view delegate was set, tell it the animation completed
+    id<UIScrollViewDelegate> scrollViewDelegate = view->_scrollView.delegate;
+    if ([scrollViewDelegate respondsToSelector:@selector(scrollViewDidEndScrollingAnimation:)]) {
+        [scrollViewDelegate scrollViewDidEndScrollingAnimation:view->_scrollView];
     }
+}
 
-    view->_disableLayout = YES;
+#pragma mark - Momentum Flinging -
 
-    // Reclaim the previous view
-    TOPagingViewReclaimPageView(view, view->_previousPageView);
+- (void)_scrollViewPanGestureRecognized:(UIPanGestureRecognizer *)recognizer
+{
+    if (!_isMomentumFlingingEnabled || !_delegateFlags.delegateWillSkipByNumberOfPages) { return; }
+    if (recognizer.state != UIGestureRecognizerStateEnded) { return; }
+
+    // Work out how many pages the release velocity would carry past. Anything less than two is left to regular paging.
+    const CGFloat velocity = [recognizer velocityInView:self].x;
+    const NSInteger pageCount = MIN((NSInteger)(fabs(velocity) / kTOPagingViewMomentumVelocityPerPage),
+                                    kTOPagingViewMomentumMaximumPageCount);
+    if (pageCount < 2) { return; }
+
+    // Flinging to the left travels towards the pages on the right, and vice versa
+    const UIRectEdge edge = (velocity < 0.0f) ? UIRectEdgeRight : UIRectEdgeLeft;
+    const TOPagingViewPageType type = TOPagingViewPageTypeForEdge(self, edge);
+    const BOOL isDetectingDirection = _isDynamicPageDirectionEnabled
+                                        && TOPagingViewIsInitialPageForPageView(self, _currentPageView);
+    if (isDetectingDirection || !TOPagingViewHasPageOfType(self, type)) { return; }
 
-    // Update all of the references by pushing each view back
-    view->_previousPageView = view->_currentPageView;
-    view->_currentPageView = view->_nextPageView;
-    view->_nextPageView = nil;
+    // Let the scroll view start its own deceleration first, so the skip can cleanly cancel it on the next tick
+    __weak __typeof(self) weakSelf = self;
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [weakSelf _performMomentumFlingTowardsEdge:edge pageCount:(type == TOPagingViewPageTypeNext) ? pageCount : -pageCount];
+    });
+}
 
-    // Update the frames of the pages
-    view->_currentPageView.frame = TOPagingViewCurrentPageFrame(view);
-    view->_previousPageView.frame = TOPagingViewPreviousPageFrame(view);
+- (void)_performMomentumFlingTowardsEdge:(UIRectEdge)edge pageCount:(NSInteger)pageCount TOPAGINGVIEW_OBJC_DIRECT
+{
+    // Let the delegate move the data source to the landing page, and tell us how far that actually was
+    id const delegate = _delegate;
+    if (delegate == nil) { return; }
+    const NSInteger travelledPageCount = _delegateIMPs.willSkipByNumberOfPages(delegate,
+                                                                    @selector(pagingView:willSkipByNumberOfPages:), self, pageCount);
+    if (labs(travelledPageCount) < 2) { return; }
 
-    // Inform the delegate we have comitted to a transition so we can update state for the next page
-    if (view->_delegateFlags.delegateDidTurnToPage) {
-        [view->_delegate pagingView:view didTurnToPageOfType:TOPagingViewPageTypeNext];
-    }
+    // Skip straight to the landing page, which will animate through the pages in between
+    _momentumPageCount = labs(travelledPageCount);
+    [self _skipToNewPageInDirection:edge animated:YES];
+    _momentumPageCount = 0;
+}
+
+- (void)_fetchAdjacentPagesDuringSkip TOPAGINGVIEW_OBJC_DIRECT
+{
+    // Skip if the animation already finished and requested the pages
+    UIView *const outgoingPageView = _outgoingPageView;
+    if (outgoingPageView == nil) { return; }
+
+    [self _fetchAdjacentPagesIfAvailable];
+
+    // The outgoing page is still animating out of one of the side slots, so keep
+    // whichever adjacent page shares that slot hidden until the animation completes.
+    const CGFloat outgoingMinX = CGRectGetMinX(outgoingPageView.frame);
+    UIView *const nextPageView = _nextPageView;
+    UIView *const previousPageView = _previousPageView;
+    if (nextPageView && fabs(CGRectGetMinX(nextPageView.frame) - outgoingMinX) < 1.0f) { nextPageView.hidden = YES; }
+    if (previousPageView && fabs(CGRectGetMinX(previousPageView.frame) - outgoingMinX) < 1.0f) { previousPageView.hidden = YES; }
+}
+
+- (nullable __kindof UIView *)pageViewForUniqueIdentifier:(NSString *)identifier
+{
+    return _uniqueIdentifierPages[identifier];
+}
+
+#pragma mark - Page Snapshots -
+
+- (void)pageViewDidFinishLoadingContent:(UIView<TOPagingViewPage> *)pageView
+{
+    if (pageView == nil || [_pagesWithLoadedContent containsObject:pageView]) { return; }
+    [_pagesWithLoadedContent addObject:pageView];
+    TOPagingViewRemoveSnapshotFromPageView(self, pageView);
+
+    // If there's no snapshot of the page at this size yet, take one the next time the user isn't interacting
+    NSString *const uniqueIdentifier = [_pageUniqueIdentifiers objectForKey:pageView];
+    if (_snapshotStore == nil || uniqueIdentifier == nil) { return; }
+    if ([_snapshotStore containsSnapshotForUniqueIdentifier:uniqueIdentifier size:self.bounds.size]) { return; }
+    [_pagesPendingSnapshot addObject:pageView];
+    TOPagingViewScheduleIdleWork(self);
+}
+
+static void TOPagingViewShowSnapshotForPageView(TOPagingView *view, UIView *pageView, NSString *uniqueIdentifier)
+{
+    // Skip if the page is already showing its content, or its snapshot
+    TOPagingViewSnapshotStore *const snapshotStore = view->_snapshotStore;
+    if (snapshotStore == nil || uniqueIdentifier.length == 0) { return; }
+    if ([view->_pagesWithLoadedContent containsObject:pageView] || [view->_snapshotOverlayViews objectForKey:pageView]) { return; }
+
+    // If it's already in memory, show it straight away
+    const CGSize size = view.bounds.size;
+    UIImage *const snapshot = [snapshotStore snapshotForUniqueIdentifier:uniqueIdentifier size:size];
+    if (snapshot) {
+        TOPagingViewAddSnapshotToPageView(view, pageView, snapshot);
+        return;
+    }
+
+    // Otherwise, if there's one on disk, load it in the background, and show it if the page is still waiting for its content
+    if (![snapshotStore containsSnapshotForUniqueIdentifier:uniqueIdentifier size:size]) { return; }
+    __weak TOPagingView *weakView = view;
+    __weak UIView *weakPageView = pageView;
+    [snapshotStore loadSnapshotForUniqueIdentifier:uniqueIdentifier size:size completionHandler:^(UIImage *loadedSnapshot) {
+        TOPagingView *const strongView = weakView;
+        UIView *const strongPageView = weakPageView;
+        if (strongView == nil || strongPageView == nil || loadedSnapshot == nil) { return; }
+        if (strongPageView.superview != strongView->_scrollView) { return; }
+        if ([strongView->_pagesWithLoadedContent containsObject:strongPageView]) { return; }
+        if ([strongView->_snapshotOverlayViews objectForKey:strongPageView]) { return; }
+        if (![[strongView->_pageUniqueIdentifiers objectForKey:strongPageView] isEqualToString:uniqueIdentifier]) { return; }
+        TOPagingViewAddSnapshotToPageView(strongView, strongPageView, loadedSnapshot);
+    }];
+}
+
+static void TOPagingViewAddSnapshotToPageView(TOPagingView *view, UIView *pageView, UIImage *snapshot)
+{
+    // Cover the page as a subview, so it moves along with it
+    UIImageView *const snapshotView = [[UIImageView alloc] initWithImage:snapshot];
+    snapshotView.frame = pageView.bounds;
+    snapshotView.autoresizingMask = UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight;
+    snapshotView.userInteractionEnabled = NO;
+    [pageView addSubview:snapshotView];
+    [view->_snapshotOverlayViews setObject:snapshotView forKey:pageView];
+}
+
+static void TOPagingViewRemoveSnapshotFromPageView(TOPagingView *view, UIView *pageView)
+{
+    UIImageView *const snapshotView = [view->_snapshotOverlayViews objectForKey:pageView];
+    if (snapshotView == nil) { return; }
+    [snapshotView removeFromSuperview];
+    [view->_snapshotOverlayViews removeObjectForKey:pageView];
+}
+
+static void TOPagingViewStorePendingSnapshot(TOPagingView *view)
+{
+    UIView *const pageView = view->_pagesPendingSnapshot.anyObject;
+    if (pageView == nil) { return; }
+    [view->_pagesPendingSnapshot removeObject:pageView];
+
+    // Only snapshot pages still in a slot, and still showing the content they finished loading
+    if (pageView.superview != view->_scrollView || ![view->_pagesWithLoadedContent containsObject:pageView]) { return; }
+    NSString *const uniqueIdentifier = [view->_pageUniqueIdentifiers objectForKey:pageView];
+    if (uniqueIdentifier == nil) { return; }
+    [view->_snapshotStore storeSnapshotOfView:pageView forUniqueIdentifier:uniqueIdentifier];
+}
+
+#pragma mark - Page View Recycling -
+
+static void TOPagingViewInsertPageView(TOPagingView *view, UIView<TOPagingViewPage> *pageView)
+{
+    if (pageView == nil) { return; }
+
+    // Add the view to the scroll view, moving it out of the recycled pages container if needed
+    if (pageView.superview != view->_scrollView) { [view->_scrollView addSubview:pageView]; }
+    pageView.hidden = NO;
+
+    // Cache the page's protocol methods if it hasn't been done yet
+    const TOPageViewProtocolIMPs imps = TOPagingViewCachedProtocolIMPsForPageView(view, pageView);
+
+    // If it has a unique identifier, store it so we can refer to it easily
+    if (imps.uniqueIdentifier) {
+        NSString *const uniqueIdentifier = imps.uniqueIdentifier(pageView, @selector(uniqueIdentifier));
+        TOPagingViewIndexPageView(view, pageView, uniqueIdentifier);
+        TOPagingViewShowSnapshotForPageView(view, pageView, uniqueIdentifier);
+    }
+
+    // The page is being shown again, so it no longer needs to be prepared for reuse
+    [view->_pagesPendingReuse removeObject:pageView];
+
+    // If the page view supports it, inform the delegate of the current page direction
+    if (imps.setPageDirection) {
+        imps.setPageDirection(pageView, @selector(setPageDirection:), view->_pageScrollDirection);
+    }
+
+    // Remove it from the pool of recycled pages
+    NSString *pageIdentifier = TOPagingViewIdentifierForPageViewClass(view, pageView.class);
+    [view->_queuedPages[pageIdentifier] removeObject:pageView];
+}
+
+static inline void TOPagingViewInvalidateOrderedVisiblePageViews(TOPagingView *view)
+{
+    // The cached array holds strong references, so drop it before it can outlive a page that has left the slots
+    view->_orderedVisiblePageViews = nil;
+    view->_orderedPreviousPageView = nil;
+    view->_orderedCurrentPageView = nil;
+    view->_orderedNextPageView = nil;
+}
+
+static void TOPagingViewReclaimPageView(TOPagingView *view, UIView *pageView)
+{
+    if (pageView == nil) { return; }
+
+    // Let the page know it has left the slots so it can stop any ongoing work
+    TOPagingViewSendLifecycleEventToPageView(view, TOPagingViewPageLifecycleEventDidBecomeHidden, pageView);
+    TOPagingViewRemoveSnapshotFromPageView(view, pageView);
+    TOPagingViewInvalidateOrderedVisiblePageViews(view);
+
+    // Defer cleaning up the page until it is actually re-used. Until then, it keeps its
+    // content and its entry in the unique identifier index so it can be shown again for free.
+    [view->_pagesPendingReuse addObject:pageView];
+
+    // Park the view in the hidden container so it no longer weighs on the scroll view's
+    // hit-testing and layout (Don't remove it from the window because that is a heavier operation)
+    [view->_pooledPagesView addSubview:pageView];
+
+    // Re-add it to the recycled pages pool, and drop any pages that exceed the pool's capacity
+    NSString *pageIdentifier = TOPagingViewIdentifierForPageViewClass(view, pageView.class);
+    NSMutableSet *const pool = view->_queuedPages[pageIdentifier];
+    [pool addObject:pageView];
+    TOPagingViewTrimPagePool(view, pool, view->_resourceLimits.pagePoolCapacity);
+}
+
+static void TOPagingViewTrimPagePool(TOPagingView *view, NSMutableSet *pool, NSUInteger capacity)
+{
+    // The cache may have been rebuilt by a page's lifecycle callback before the page was cleared from its slot
+    if (pool.count > capacity) { TOPagingViewInvalidateOrderedVisiblePageViews(view); }
+
+    while (pool.count > capacity) {
+        UIView *const pageView = pool.anyObject;
+        [pool removeObject:pageView];
+        [view->_pagesPendingReuse removeObject:pageView];
+
+        // Remove it from the unique identifier index so it can be released
+        NSString *const uniqueIdentifier = [view->_pageUniqueIdentifiers objectForKey:pageView];
+        if (uniqueIdentifier && view->_uniqueIdentifierPages[uniqueIdentifier] == pageView) {
+            [view->_uniqueIdentifierPages removeObjectForKey:uniqueIdentifier];
+        }
+        [view->_pageUniqueIdentifiers removeObjectForKey:pageView];
+
+        // Only detach it if it's actually in the pool, and not a page that was just dequeued
+        if (pageView.superview == view->_pooledPagesView) { [pageView removeFromSuperview]; }
+    }
+}
+
+static void TOPagingViewIndexPageView(TOPagingView *view, UIView *pageView, NSString *uniqueIdentifier)
+{
+    // Skip if the page is already indexed against this identifier
+    NSString *const previousIdentifier = [view->_pageUniqueIdentifiers objectForKey:pageView];
+    if (previousIdentifier == uniqueIdentifier || [previousIdentifier isEqualToString:uniqueIdentifier]) { return; }
+
+    // Remove the stale entry if the page has been reconfigured with new content
+    if (previousIdentifier && view->_uniqueIdentifierPages[previousIdentifier] == pageView) {
+        [view->_uniqueIdentifierPages removeObjectForKey:previousIdentifier];
+    }
+
+    if (uniqueIdentifier.length == 0) {
+        [view->_pageUniqueIdentifiers removeObjectForKey:pageView];
+        return;
+    }
+
+    // Lazily create the dictionary as needed
+    if (view->_uniqueIdentifierPages == nil) {
+        view->_uniqueIdentifierPages = [NSMutableDictionary dictionary];
+    }
+
+    // Make sure any page previously indexed against this identifier no longer points at it
+    UIView *const existingPageView = view->_uniqueIdentifierPages[uniqueIdentifier];
+    if (existingPageView && existingPageView != pageView) {
+        [view->_pageUniqueIdentifiers removeObjectForKey:existingPageView];
+    }
+
+    // Add to the dictionary, and cache the identifier against the page
+    view->_uniqueIdentifierPages[uniqueIdentifier] = pageView;
+    [view->_pageUniqueIdentifiers setObject:uniqueIdentifier forKey:pageView];
+}
+
+static void TOPagingViewPreparePageViewForReuse(TOPagingView *view, UIView *pageView)
+{
+    // Skip if the page was already cleaned up
+    if (![view->_pagesPendingReuse containsObject:pageView]) { return; }
+    [view->_pagesPendingReuse removeObject:pageView];
+
+    // The page is about to receive new content, so remove it from the index using its cached identifier
+    NSString *const uniqueIdentifier = [view->_pageUniqueIdentifiers objectForKey:pageView];
+    if (uniqueIdentifier) {
+        if (view->_uniqueIdentifierPages[uniqueIdentifier] == pageView) {
+            [view->_uniqueIdentifierPages removeObjectForKey:uniqueIdentifier];
+        }
+        [view->_pageUniqueIdentifiers removeObjectForKey:pageView];
+    }
+
+    // Its content is about to be replaced, so it will need to load again
+    [view->_pagesWithLoadedContent removeObject:pageView];
+    [view->_pagesPendingSnapshot removeObject:pageView];
+
+    // If the class supports the clean up method, clean it up now
+    const TOPageViewProtocolIMPs imps = TOPagingViewCachedProtocolIMPsForPageView(view, pageView);
+    if (imps.prepareForReuse) {
+        imps.prepareForReuse(pageView, @selector(prepareForReuse));
+    }
+}
+
+#pragma mark - Page Transitions -
+
+static inline void TOPagingViewTransitionOverToNextPage(TOPagingView *view)
+{
+    // Don't start churning if we already confirmed there is no page after this,
+    // or if the next page hasn't been fetched yet.
+    if (!view->_hasNextPage || view->_nextPageView == nil) { return; }
+
+    // If the user turned towards the real next page, the snapshot on the other side is no longer needed
+    TOPagingViewRemoveMirroredNextPage(view);
+
+    // If we moved over to the threshold of the next page,
+    // re-enable the previous page
+    if (!view->_hasPreviousPage) {
+        view->_hasPreviousPage = YES;
+    }
+
+    view->_disableLayout = YES;
+    view->_lastTurnPageType = TOPagingViewPageTypeNext;
+    TOPagingViewRecordPageDwellTime(view);
+    TOPagingViewPublishEvent(view, TOPagingViewEventTypeTurnToNextPage, 1);
+    TOPagingViewBeginTransition(view, TOPagingViewTransitionTurnToNextPage);
+
+    // Reclaim the previous view
+    TOPagingViewReclaimPageView(view, view->_previousPageView);
+
+    // Update all of the references by pushing each view back
+    TOPagingViewSendLifecycleEventToPageView(view, TOPagingViewPageLifecycleEventWillBecomeCurrent, view->_nextPageView);
+    view->_previousPageView = view->_currentPageView;
+    view->_currentPageView = view->_nextPageView;
+    view->_nextPageView = nil;
+
+    // Update the frames of the pages
+    view->_currentPageView.frame = TOPagingViewCurrentPageFrame(view);
+    view->_previousPageView.frame = TOPagingViewPreviousPageFrame(view);
+    TOPagingViewSendLifecycleEventToPageView(view, TOPagingViewPageLifecycleEventDidMoveToAdjacentSlot, view->_previousPageView);
+    TOPagingViewSendLifecycleEventToPageView(view, TOPagingViewPageLifecycleEventDidBecomeCurrent, view->_currentPageView);
+
+    // Inform the delegate we have comitted to a transition so we can update state for the next page
+    if (view->_delegateFlags.delegateDidTurnToPage) {
+        TOPagingViewNotifyDidTurnToPage(view, TOPagingViewPageTypeNext);
+    }
+    TOPagingViewAddTurnToPendingBatch(view, TOPagingViewPageTypeNext);
 
     // Offload the heavy work to a new run-loop cyle so we don't overload the current one
     view->_needsNextPage = YES;
@@ -1187,8 +2203,9 @@ static inline void TOPagingViewTransitionOverToNextPage(TOPagingView *view)
 
 static inline void TOPagingViewTransitionOverToPreviousPage(TOPagingView *view)
 {
-    // Don't start churning if we already confirmed there is no page before this.
-    if (!view->_hasPreviousPage) { return; }
+    // Don't start churning if we already confirmed there is no page before this,
+    // or if the previous page hasn't been fetched yet.
+    if (!view->_hasPreviousPage || view->_previousPageView == nil) { return; }
 
     // If we confirmed we moved away from the next page, re-enable
     // so we can query again next time
@@ -1197,11 +2214,16 @@ static inline void TOPagingViewTransitionOverToPreviousPage(TOPagingView *view)
     }
 
     view->_disableLayout = YES;
+    view->_lastTurnPageType = TOPagingViewPageTypePrevious;
+    TOPagingViewRecordPageDwellTime(view);
+    TOPagingViewPublishEvent(view, TOPagingViewEventTypeTurnToPreviousPage, -1);
+    TOPagingViewBeginTransition(view, TOPagingViewTransitionTurnToPreviousPage);
 
     // Reclaim the next view
     TOPagingViewReclaimPageView(view, view->_nextPageView);
 
     // Update all of the references by pushing each view forward
+    TOPagingViewSendLifecycleEventToPageView(view, TOPagingViewPageLifecycleEventWillBecomeCurrent, view->_previousPageView);
     view->_nextPageView = view->_currentPageView;
     view->_currentPageView = view->_previousPageView;
     view->_previousPageView = nil;
@@ -1209,11 +2231,14 @@ static inline void TOPagingViewTransitionOverToPreviousPage(TOPagingView *view)
     // Update the frames of the pages
     view->_currentPageView.frame = TOPagingViewCurrentPageFrame(view);
     view->_nextPageView.frame = TOPagingViewNextPageFrame(view);
+    TOPagingViewSendLifecycleEventToPageView(view, TOPagingViewPageLifecycleEventDidMoveToAdjacentSlot, view->_nextPageView);
+    TOPagingViewSendLifecycleEventToPageView(view, TOPagingViewPageLifecycleEventDidBecomeCurrent, view->_currentPageView);
 
     // Inform the delegate we have just committed to a transition so we can update state for the previous page
     if (view->_delegateFlags.delegateDidTurnToPage) {
-        [view->_delegate pagingView:view didTurnToPageOfType:TOPagingViewPageTypePrevious];
+        TOPagingViewNotifyDidTurnToPage(view, TOPagingViewPageTypePrevious);
     }
+    TOPagingViewAddTurnToPendingBatch(view, TOPagingViewPageTypePrevious);
 
     // Offload the heavy work to a new run-loop cyle so we don't overload the current one
     view->_needsPreviousPage = YES;
@@ -1240,15 +2265,15 @@ static inline void TOPagingViewTransitionOverToPreviousPage(TOPagingView *view)
 - (void)_fetchNewNextPage TOPAGINGVIEW_OBJC_DIRECT
 {
     // Query the data source for the next page
-    UIView<TOPagingViewPage> *nextPage = [_dataSource pagingView:self
-                                                 pageViewForType:TOPagingViewPageTypeNext
-                                                 currentPageView:_nextPageView];
+    UIView<TOPagingViewPage> *nextPage = TOPagingViewRequestPageView(self, TOPagingViewPageTypeNext, _nextPageView);
 
     if (nextPage) {
         // Insert the new page object and update its position (Will fall through if nil)
         TOPagingViewInsertPageView(self, nextPage);
         _nextPageView = nextPage;
         _nextPageView.frame = TOPagingViewNextPageFrame(self);
+        TOPagingViewSendLifecycleEventToPageView(self, TOPagingViewPageLifecycleEventDidMoveToAdjacentSlot, nextPage);
+        TOPagingViewSetNeedsPrewarmForPageType(self, TOPagingViewPageTypeNext);
     }
 
     // If the next page ended up being nil,
@@ -1259,60 +2284,71 @@ static inline void TOPagingViewTransitionOverToPreviousPage(TOPagingView *view)
 - (void)_fetchNewPreviousPage TOPAGINGVIEW_OBJC_DIRECT
 {
     // Query the data source for the previous page, and exit out if there is no more page data
-    UIView<TOPagingViewPage> *previousPage = [_dataSource pagingView:self
-                                                     pageViewForType:TOPagingViewPageTypePrevious
-                                                     currentPageView:_previousPageView];
+    UIView<TOPagingViewPage> *previousPage = TOPagingViewRequestPageView(self, TOPagingViewPageTypePrevious, _previousPageView);
 
     if (previousPage) {
         // Insert the new page object and set its position (Will fall through if nil)
         TOPagingViewInsertPageView(self, previousPage);
         _previousPageView = previousPage;
         _previousPageView.frame = TOPagingViewPreviousPageFrame(self);
+        TOPagingViewSendLifecycleEventToPageView(self, TOPagingViewPageLifecycleEventDidMoveToAdjacentSlot, previousPage);
+        TOPagingViewSetNeedsPrewarmForPageType(self, TOPagingViewPageTypePrevious);
     }
 
     // If the previous page ended up being nil, set a flag so we don't check again until we need to
     _hasPreviousPage = (previousPage != nil);
 }
 
+static void TOPagingViewInsertMirroredNextPage(TOPagingView *view)
+{
+    UIView<TOPagingViewPage> *const nextPageView = view->_nextPageView;
+    if (!view->_hasNextPage || nextPageView == nil) { return; }
+
+    // Either side of the initial page may become the next page, so rather than requesting the same
+    // page from the data source twice, cover the other side with a lightweight snapshot of it.
+    UIView *const snapshotView = [nextPageView snapshotViewAfterScreenUpdates:NO];
+    if (snapshotView == nil) { return; }
+    snapshotView.frame = TOPagingViewPreviousPageFrame(view);
+    [view->_scrollView addSubview:snapshotView];
+    view->_mirroredNextPageView = snapshotView;
+}
+
+static void TOPagingViewRemoveMirroredNextPage(TOPagingView *view)
+{
+    if (view->_mirroredNextPageView == nil) { return; }
+    [view->_mirroredNextPageView removeFromSuperview];
+    view->_mirroredNextPageView = nil;
+}
+
 - (void)_rearrangePagesForScrollDirection:(TOPagingViewDirection)direction TOPAGINGVIEW_OBJC_DIRECT
 {
-    // Left is for Eastern type layouts
-    const BOOL leftDirection = (direction == TOPagingViewDirectionRightToLeft);
-    
-    const CGFloat segmentWidth = TOPagingViewScrollViewPageWidth(self);
-    const CGFloat contentWidth = _scrollView.contentSize.width;
-    const CGFloat halfSpacing = self.pageSpacing * 0.5f;
-    const CGFloat rightOffset = (contentWidth - segmentWidth) + halfSpacing;
-
-    // Move the next page to the left if direction is left, or vice versa
-    if (_nextPageView) {
-        CGRect frame = _nextPageView.frame;
-        if (leftDirection) { frame.origin.x = halfSpacing; }
-        else { frame.origin.x = rightOffset; }
-        _nextPageView.frame = frame;
-    }
-    
-    // Move the previous page to the right if direction is left, or vice versa
-    if (_previousPageView) {
-        CGRect frame = _previousPageView.frame;
-        if (leftDirection) { frame.origin.x = rightOffset; }
-        else { frame.origin.x = halfSpacing; }
-        _previousPageView.frame = frame;
+    // The direction is just a mapping of page types to slots, so flipping it only swaps which
+    // slot the next and previous pages sit in. Move them both in a single pass, with implicit
+    // animations disabled, and without touching the current page at all.
+    UIView *const nextPageView = _nextPageView;
+    UIView *const previousPageView = _previousPageView;
+    const UIEdgeInsets insets = _slotContentInset;
+
+    [CATransaction begin];
+    [CATransaction setDisableActions:YES];
+    _disableLayout = YES;
+    {
+        // Only the origin changes, so the pages won't need to lay out their subviews here
+        if (nextPageView) { nextPageView.center = TOPagingViewCenterForSlot(self, TOPagingViewSlotForPageType(self, TOPagingViewPageTypeNext)); }
+        if (previousPageView) { previousPageView.center = TOPagingViewCenterForSlot(self, TOPagingViewSlotForPageType(self, TOPagingViewPageTypePrevious)); }
+
+        // Flip the content insets if we were potentially at the end of the scroll view
+        _slotContentInset = (UIEdgeInsets){insets.top, insets.right, insets.bottom, insets.left};
+        _needsSlotContentInsetUpdate = (insets.left != insets.right);
+        TOPagingViewCommitSlotContentInset(self);
     }
-    
-    // Inform all of the pages that the direction changed, so they can re-arrange their subviews as needed
-    TOPagingViewSetPageDirectionForPageView(self, direction, _currentPageView);
-    TOPagingViewSetPageDirectionForPageView(self, direction, _nextPageView);
-    TOPagingViewSetPageDirectionForPageView(self, direction, _previousPageView);
-
-    // Flip the content insets if we were potentially at the end of the scroll view
-    UIEdgeInsets insets = _scrollView.contentInset;
-    CGFloat leftInset = insets.left;
-    insets.left = insets.right;
-    insets.right = leftInset;
-    TOPagingViewPerformBlockWithoutLayout(self, ^{
-        self->_scrollView.contentInset = insets;
-    });
+    _disableLayout = NO;
+    [CATransaction commit];
+
+    // Defer informing the pages so they can re-arrange their subviews at the next idle point,
+    // rather than in the middle of a potential interaction.
+    _needsPageDirectionUpdate = YES;
+    TOPagingViewScheduleIdleWork(self);
 }
 
 - (void)_playBounceAnimationInDirection:(TOPagingViewDirection)direction TOPAGINGVIEW_OBJC_DIRECT
@@ -1395,6 +2431,7 @@ static inline void TOPagingViewTransitionOverToPreviousPage(TOPagingView *view)
     // If we have dynamic page detection, and we're on the origin page,
     // don't request a previous page since we're re-using just the next page.
     if (_isDynamicPageDirectionEnabled && TOPagingViewIsInitialPageForPageView(self, _currentPageView)) {
+        if (_needsPreviousPage) { _hasPreviousPage = _hasNextPage; }
         _needsPreviousPage = NO;
         return;
     }
@@ -1420,45 +2457,472 @@ static inline void TOPagingViewTransitionOverToPreviousPage(TOPagingView *view)
     }
 }
 
-#pragma mark - Keyboard Control -
+#pragma mark - Data Source Requests -
 
-- (BOOL)canBecomeFirstResponder { return YES; }
+static inline void TOPagingViewBeginTransition(TOPagingView *view, TOPagingViewTransition transition)
+{
+    view->_currentTransition = transition;
+    view->_currentTransitionRequestCount = 0;
+    view->_isNextPageConfirmedMissing = NO;
+    view->_isPreviousPageConfirmedMissing = NO;
+}
 
-- (NSArray<UIKeyCommand *> *)keyCommands
+static inline UIView<TOPagingViewPage> *TOPagingViewRequestPageView(TOPagingView *view,
+                                                                    TOPagingViewPageType type,
+                                                                    UIView<TOPagingViewPage> *currentPageView)
+{
+    view->_metrics.dataSourceRequestCount++;
+
+    // Every request is counted against whichever transition caused it. Exceeding the budget
+    // means the same page has likely been requested twice somewhere along the way.
+    const NSUInteger requestCount = ++view->_currentTransitionRequestCount;
+    const NSUInteger budget = kTOPagingViewDataSourceBudget[view->_currentTransition];
+    if (requestCount > budget) {
+        view->_metrics.dataSourceBudgetOverrunCount++;
+        #if TOPAGINGVIEW_DATA_SOURCE_BUDGET_MODE >= 2
+        NSCAssert(NO, @"TOPagingView: Transition %ld made %lu data source requests, but only %lu were expected.",
+                  (long)view->_currentTransition, (unsigned long)requestCount, (unsigned long)budget);
+        #elif TOPAGINGVIEW_DATA_SOURCE_BUDGET_MODE == 1
+        NSLog(@"TOPagingView: Transition %ld made %lu data source requests, but only %lu were expected.",
+              (long)view->_currentTransition, (unsigned long)requestCount, (unsigned long)budget);
+        #endif
+    }
+
+    id const dataSource = view->_dataSource;
+    if (dataSource == nil) { return nil; }
+    return view->_delegateIMPs.pageViewForType(dataSource, @selector(pagingView:pageViewForType:currentPageView:),
+                                               view, type, currentPageView);
+}
+
+static inline void TOPagingViewNotifyWillTurnToPage(TOPagingView *view, TOPagingViewPageType type)
 {
-    SEL selector = @selector(arrowKeyPressed:);
-    UIKeyCommand *leftArrowCommand = [UIKeyCommand keyCommandWithInput:UIKeyInputLeftArrow
-                                                         modifierFlags:0
-                                                                action:selector];
+    id const delegate = view->_delegate;
+    if (delegate == nil) { return; }
+    view->_delegateIMPs.willTurnToPage(delegate, @selector(pagingView:willTurnToPageOfType:), view, type);
+}
 
-    UIKeyCommand *rightArrowCommand = [UIKeyCommand keyCommandWithInput:UIKeyInputRightArrow
-                                                          modifierFlags:0
-                                                                 action:selector];
+static inline void TOPagingViewNotifyDidTurnToPage(TOPagingView *view, TOPagingViewPageType type)
+{
+    id const delegate = view->_delegate;
+    if (delegate == nil) { return; }
+    view->_delegateIMPs.didTurnToPage(delegate, @selector(pagingView:didTurnToPageOfType:), view, type);
+}
+
+static inline void TOPagingViewAddTurnToPendingBatch(TOPagingView *view, TOPagingViewPageType type)
+{
+    if (!view->_isPageTurnBatchingEnabled || !view->_delegateFlags.delegateDidTurnPagesInBatch) { return; }
+
+    view->_pendingPageTurnBatch.netPageOffset += (type == TOPagingViewPageTypeNext) ? 1 : -1;
+    view->_pendingPageTurnBatch.turnCount++;
+    view->_pendingPageTurnBatch.finalPageType = type;
+
+    // Deliver the batch at the next idle point, which won't occur until any user interaction has finished
+    TOPagingViewScheduleIdleWork(view);
+}
 
-    if (@available(iOS 15.0, *)) {
-        leftArrowCommand.wantsPriorityOverSystemBehavior = YES;
-        rightArrowCommand.wantsPriorityOverSystemBehavior = YES;
+static inline void TOPagingViewPublishEvent(TOPagingView *view, TOPagingViewEventType type, int32_t value)
+{
+    TOPagingViewEventRing *const eventRing = view->_eventRing;
+    if (eventRing == nil) { return; }
+    [eventRing publishEvent:(TOPagingViewEvent){ .timestamp = CACurrentMediaTime(), .value = value, .type = type }];
+}
+
+#pragma mark - Idle Work -
+
+static void TOPagingViewScheduleIdleWork(TOPagingView *view)
+{
+    // Skip if an observer is already waiting
+    if (view->_idleObserver != NULL) { return; }
+
+    // Register a one-shot observer for when the main run loop next finishes its current work and goes to sleep.
+    // This is only registered in the default mode, so it will wait until any user interactions have finished.
+    __weak TOPagingView *weakView = view;
+    CFRunLoopObserverRef observer = CFRunLoopObserverCreateWithHandler(kCFAllocatorDefault, kCFRunLoopBeforeWaiting, false, 0,
+                                                                       ^(CFRunLoopObserverRef observer, CFRunLoopActivity activity) {
+        [weakView _performIdleWork];
+    });
+    CFRunLoopAddObserver(CFRunLoopGetMain(), observer, kCFRunLoopDefaultMode);
+    view->_idleObserver = observer;
+}
+
+- (void)_performIdleWork TOPAGINGVIEW_OBJC_DIRECT
+{
+    // Release the observer so more work may be scheduled from here
+    if (_idleObserver != NULL) {
+        CFRunLoopObserverInvalidate(_idleObserver);
+        CFRelease(_idleObserver);
+        _idleObserver = NULL;
+    }
+
+    // Resize the adjacent pages after a live resize, now that the current page has been shown at the new size
+    if (_needsAdjacentPageResize) {
+        TOPagingViewResizeAdjacentPages(self);
     }
 
-    return @[leftArrowCommand, rightArrowCommand];
+    // Inform all of the pages that the direction changed, so they can re-arrange their subviews as needed
+    if (_needsPageDirectionUpdate) {
+        _needsPageDirectionUpdate = NO;
+        TOPagingViewSetPageDirectionForPageView(self, _pageScrollDirection, _currentPageView);
+        TOPagingViewSetPageDirectionForPageView(self, _pageScrollDirection, _nextPageView);
+        TOPagingViewSetPageDirectionForPageView(self, _pageScrollDirection, _previousPageView);
+    }
+
+    // Deliver any batched page turns, but only once the interaction that caused them has fully settled
+    if (_pendingPageTurnBatch.turnCount > 0) {
+        const BOOL isSettled = !_scrollView.isTracking && !_scrollView.isDecelerating
+                                && !_pageViewAnimator.isRunning && !_disableLayout;
+        if (isSettled) {
+            const TOPagingViewPageTurnBatch batch = _pendingPageTurnBatch;
+            memset(&_pendingPageTurnBatch, 0, sizeof(TOPagingViewPageTurnBatch));
+            id const delegate = _delegate;
+            if (delegate && _delegateFlags.delegateDidTurnPagesInBatch) {
+                _delegateIMPs.didTurnPagesInBatch(delegate, @selector(pagingView:didTurnPagesInBatch:), self, batch);
+            }
+        } else {
+            TOPagingViewScheduleIdleWork(self);
+        }
+    }
+
+    // Lay out and draw the adjacent pages ahead of time, so the first frame of a swipe only needs to composite them.
+    // Only one page is prepared per idle point, starting with the direction the user has been reading in.
+    if ((_needsNextPagePrewarm || _needsPreviousPagePrewarm) && CACurrentMediaTime() >= _pacedPrewarmTime) {
+        const BOOL prefersPreviousPage = (_lastTurnPageType == TOPagingViewPageTypePrevious);
+        if (_needsNextPagePrewarm && (!prefersPreviousPage || !_needsPreviousPagePrewarm)) {
+            _needsNextPagePrewarm = NO;
+            TOPagingViewPrewarmPageView(_nextPageView);
+        } else {
+            _needsPreviousPagePrewarm = NO;
+            TOPagingViewPrewarmPageView(_previousPageView);
+        }
+
+        // If the other page still needs preparing, come back for it at the next idle point
+        if (_needsNextPagePrewarm || _needsPreviousPagePrewarm) {
+            TOPagingViewScheduleIdleWork(self);
+            CFRunLoopWakeUp(CFRunLoopGetMain());
+        }
+    }
+
+    // Snapshot any pages that have finished loading, one per idle point, and only while the user isn't interacting
+    if (_pagesPendingSnapshot.count > 0) {
+        const BOOL isSettled = !_scrollView.isTracking && !_scrollView.isDecelerating
+                                && !_pageViewAnimator.isRunning && !_disableLayout;
+        if (isSettled) { TOPagingViewStorePendingSnapshot(self); }
+        if (_pagesPendingSnapshot.count > 0) {
+            TOPagingViewScheduleIdleWork(self);
+            if (isSettled) { CFRunLoopWakeUp(CFRunLoopGetMain()); }
+        }
+    }
+}
+
+static inline void TOPagingViewSetNeedsPrewarmForPageType(TOPagingView *view, TOPagingViewPageType type)
+{
+    // Skip if the resource policy doesn't allow preparing pages ahead of time
+    if (view->_resourceLimits.prefetchRadius == 0) { return; }
+
+    if (type == TOPagingViewPageTypeNext) { view->_needsNextPagePrewarm = YES; }
+    else if (type == TOPagingViewPageTypePrevious) { view->_needsPreviousPagePrewarm = YES; }
+
+    // If the reading pace is known, hold off until shortly before the user is predicted to turn the page
+    const CFTimeInterval now = CACurrentMediaTime();
+    view->_pacedPrewarmTime = 0.0f;
+    if (view->_isReadingPaceEstimationEnabled && view->_pageDwellSampleCount >= kTOPagingViewReadingPaceMinimumSampleCount) {
+        view->_pacedPrewarmTime = view->_currentPageStartTime + view->_estimatedPageDwellTime - kTOPagingViewReadingPaceLeadTime;
+    }
+
+    if (view->_pacedPrewarmTime <= now) {
+        TOPagingViewScheduleIdleWork(view);
+        return;
+    }
+
+    // Schedule the idle work for then, ignoring any earlier schedules that have since been replaced
+    const NSUInteger generation = ++view->_pacedPrewarmGeneration;
+    __weak TOPagingView *weakView = view;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)((view->_pacedPrewarmTime - now) * NSEC_PER_SEC)),
+                   dispatch_get_main_queue(), ^{
+        TOPagingView *const strongView = weakView;
+        if (strongView == nil || strongView->_pacedPrewarmGeneration != generation) { return; }
+        TOPagingViewScheduleIdleWork(strongView);
+    });
+}
+
+static BOOL TOPagingViewShouldHoldPendingPages(TOPagingView *view)
+{
+    // Request straight away unless the pace is known, or once the user has started dragging towards the pages.
+    // (Linked views are driven by each other, so they never hold their pages back)
+    view->_isHoldingPendingPages = NO;
+    if (!view->_needsNextPage && !view->_needsPreviousPage) { return NO; }
+    if (!view->_isReadingPaceEstimationEnabled || view->_pageDwellSampleCount < kTOPagingViewReadingPaceMinimumSampleCount) { return NO; }
+    if (view->_coordinator != nil || view->_scrollView.isTracking) { return NO; }
+
+    // Hold off until shortly before the user is predicted to turn the page
+    const CFTimeInterval now = CACurrentMediaTime();
+    const CFTimeInterval requestTime = view->_currentPageStartTime + view->_estimatedPageDwellTime - kTOPagingViewReadingPaceLeadTime;
+    if (requestTime <= now) { return NO; }
+    view->_isHoldingPendingPages = YES;
+
+    // Schedule a layout pass for then, unless one is already scheduled for the same time
+    if (view->_pacedPageRequestTime == requestTime) { return YES; }
+    view->_pacedPageRequestTime = requestTime;
+    const NSUInteger generation = ++view->_pacedPageRequestGeneration;
+    __weak TOPagingView *weakView = view;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)((requestTime - now) * NSEC_PER_SEC)),
+                   dispatch_get_main_queue(), ^{
+        TOPagingView *const strongView = weakView;
+        if (strongView == nil || strongView->_pacedPageRequestGeneration != generation) { return; }
+        [strongView setNeedsLayout];
+    });
+    return YES;
+}
+
+static void TOPagingViewRequestHeldPendingPages(TOPagingView *view)
+{
+    // A programmatic turn needs its destination page straight away, so stop holding the pending pages back.
+    // Pending pages are requested one per call, so call again in case both were pending.
+    if (!view->_isHoldingPendingPages) { return; }
+    view->_isHoldingPendingPages = NO;
+    view->_pacedPageRequestGeneration++;
+    view->_pacedPageRequestTime = 0.0f;
+    [view _requestPendingPages];
+    [view _requestPendingPages];
+}
+
+static inline void TOPagingViewRecordPageDwellTime(TOPagingView *view)
+{
+    if (!view->_isReadingPaceEstimationEnabled) { return; }
+
+    const CFTimeInterval now = CACurrentMediaTime();
+    const CFTimeInterval startTime = view->_currentPageStartTime;
+    view->_currentPageStartTime = now;
+    if (startTime <= 0.0f) { return; }
+
+    // Discard any times that don't reflect the user actually reading the page
+    const CFTimeInterval dwellTime = now - startTime;
+    if (dwellTime < kTOPagingViewReadingPaceMinimumDwellTime || dwellTime > kTOPagingViewReadingPaceMaximumDwellTime) { return; }
+
+    // Blend into a moving average so the estimate follows changes in pace without jumping on every page
+    if (view->_pageDwellSampleCount == 0) {
+        view->_estimatedPageDwellTime = dwellTime;
+    } else {
+        view->_estimatedPageDwellTime += (dwellTime - view->_estimatedPageDwellTime) * kTOPagingViewReadingPaceSmoothingFactor;
+    }
+    view->_pageDwellSampleCount++;
+}
+
+static void TOPagingViewPrewarmPageView(UIView *pageView)
+{
+    if (pageView == nil) { return; }
+    [pageView layoutIfNeeded];
+    TOPagingViewDisplayLayerTreeIfNeeded(pageView.layer);
+}
+
+static void TOPagingViewDisplayLayerTreeIfNeeded(CALayer *layer)
+{
+    [layer displayIfNeeded];
+    for (CALayer *sublayer in layer.sublayers) {
+        TOPagingViewDisplayLayerTreeIfNeeded(sublayer);
+    }
 }
 
-- (void)arrowKeyPressed:(UIKeyCommand *)command
+#pragma mark - Linked Paging Views -
+
+static inline BOOL TOPagingViewHasPageOfType(TOPagingView *view, TOPagingViewPageType type)
 {
-    if ([command.input isEqualToString:UIKeyInputLeftArrow]) {
-        [self turnToLeftPageAnimated:YES];
+    const BOOL hasPage = (type == TOPagingViewPageTypePrevious) ? view->_hasPreviousPage : view->_hasNextPage;
+    TOPagingViewCoordinator *const coordinator = view->_coordinator;
+    if (!hasPage || coordinator == nil) { return hasPage; }
+
+    // Linked views can only move in a direction if all of them have a page in it that has actually been fetched,
+    // since a view still waiting on its page would be dragged past the threshold without turning.
+    // (When detecting the direction on the initial page, the next page stands in for the previous one.)
+    for (TOPagingView *linkedView in coordinator.linkedPagingViews) {
+        if (linkedView == view || linkedView->_currentPageView == nil) { continue; }
+        if (type == TOPagingViewPageTypeNext) {
+            if (!linkedView->_hasNextPage || linkedView->_nextPageView == nil) { return NO; }
+            continue;
+        }
+
+        const BOOL isDetectingDirection = linkedView->_isDynamicPageDirectionEnabled
+                                            && TOPagingViewIsInitialPageForPageView(linkedView, linkedView->_currentPageView);
+        UIView *const previousPageView = isDetectingDirection ? linkedView->_nextPageView : linkedView->_previousPageView;
+        if (!linkedView->_hasPreviousPage || previousPageView == nil) { return NO; }
+    }
+    return YES;
+}
+
+static inline void TOPagingViewSynchronizeLinkedPagingViews(TOPagingView *view)
+{
+    // Skip if this view is currently being driven by another view
+    TOPagingViewCoordinator *const coordinator = view->_coordinator;
+    if (coordinator.isDrivingPagingViews) { return; }
+
+    const CGFloat segmentWidth = TOPagingViewScrollViewPageWidth(view);
+    if (segmentWidth < FLT_EPSILON) { return; }
+
+    // Express the offset as progress towards the next page so it can be mapped onto
+    // views flowing in either direction (-1.0 is the previous page, 1.0 is the next page)
+    CGFloat progress = (view->_scrollView.contentOffset.x - segmentWidth) / segmentWidth;
+    if (TOPagingViewIsDirectionReversed(view)) { progress = -progress; }
+
+    // Move each linked view to the same progress. Their own observers will then trigger their page transitions.
+    coordinator.isDrivingPagingViews = YES;
+    for (TOPagingView *linkedView in coordinator.linkedPagingViews) {
+        if (linkedView == view || linkedView->_currentPageView == nil) { continue; }
+        const CGFloat linkedSegmentWidth = TOPagingViewScrollViewPageWidth(linkedView);
+        const CGFloat directionModifier = TOPagingViewIsDirectionReversed(linkedView) ? -1.0f : 1.0f;
+        const CGPoint offset = (CGPoint){linkedSegmentWidth + (progress * linkedSegmentWidth * directionModifier), 0.0f};
+        if (CGPointEqualToPoint(offset, linkedView->_scrollView.contentOffset)) { continue; }
+        linkedView->_scrollView.contentOffset = offset;
     }
-    else if ([command.input isEqualToString:UIKeyInputRightArrow]) {
-        [self turnToRightPageAnimated:YES];
+    coordinator.isDrivingPagingViews = NO;
+}
+
+static inline void TOPagingViewShareWillTurnWithLinkedPagingViews(TOPagingView *view, TOPagingViewPageType type)
+{
+    TOPagingViewCoordinator *const coordinator = view->_coordinator;
+    for (TOPagingView *linkedView in coordinator.linkedPagingViews) {
+        if (linkedView == view || !linkedView->_delegateFlags.delegateWillTurnToPage) { continue; }
+        TOPagingViewNotifyWillTurnToPage(linkedView, type);
     }
 }
 
+static inline void TOPagingViewRequestPendingPages(TOPagingView *view)
+{
+    // Without a coordinator, just request the pages for this view, unless they're being held for the reading pace
+    TOPagingViewCoordinator *const coordinator = view->_coordinator;
+    if (coordinator == nil) {
+        if (TOPagingViewShouldHoldPendingPages(view)) { return; }
+        [view _requestPendingPages];
+        return;
+    }
+
+    // Skip if we're already in the middle of a batch
+    if (coordinator.isRequestingPages) { return; }
+
+    // Skip if none of the linked views have any pending pages
+    BOOL hasPendingPages = NO;
+    for (TOPagingView *linkedView in coordinator.linkedPagingViews) {
+        if (linkedView->_needsNextPage || linkedView->_needsPreviousPage) { hasPendingPages = YES; break; }
+    }
+    if (!hasPendingPages) { return; }
+
+    // Request the pending pages of all of the linked views together so the data sources can batch their work
+    id<TOPagingViewCoordinatorDelegate> delegate = coordinator.delegate;
+    coordinator.isRequestingPages = YES;
+    if ([delegate respondsToSelector:@selector(pagingViewCoordinatorWillRequestPages:)]) {
+        [delegate pagingViewCoordinatorWillRequestPages:coordinator];
+    }
+    for (TOPagingView *linkedView in coordinator.linkedPagingViews) {
+        [linkedView _requestPendingPages];
+    }
+    if ([delegate respondsToSelector:@selector(pagingViewCoordinatorDidRequestPages:)]) {
+        [delegate pagingViewCoordinatorDidRequestPages:coordinator];
+    }
+    coordinator.isRequestingPages = NO;
+
+    // Any of the views may now have gained or lost a page, which changes where all of them may scroll
+    TOPagingViewUpdatePageSlotsOfLinkedPagingViews(view);
+}
+
+static void TOPagingViewUpdatePageSlotsOfLinkedPagingViews(TOPagingView *view)
+{
+    TOPagingViewCoordinator *const coordinator = view->_coordinator;
+    for (TOPagingView *linkedView in coordinator.linkedPagingViews) {
+        TOPagingViewUpdatePageSlots(linkedView);
+    }
+}
+
+static void TOPagingViewUpdatePageSlots(TOPagingView *view)
+{
+    // Views in the middle of a transition will update their own slots once it has completed
+    if (view->_currentPageView == nil || view->_disableLayout) { return; }
+
+    const BOOL isReversed = TOPagingViewIsDirectionReversed(view);
+    const BOOL hasLeftPage = TOPagingViewHasPageOfType(view, isReversed ? TOPagingViewPageTypeNext : TOPagingViewPageTypePrevious);
+    const BOOL hasRightPage = TOPagingViewHasPageOfType(view, isReversed ? TOPagingViewPageTypePrevious : TOPagingViewPageTypeNext);
+    TOPagingViewSetPageSlotEnabled(view, hasLeftPage, UIRectEdgeLeft);
+    TOPagingViewSetPageSlotEnabled(view, hasRightPage, UIRectEdgeRight);
+    TOPagingViewCommitSlotContentInset(view);
+}
+
+#pragma mark - Keyboard Control -
+
+- (BOOL)canBecomeFirstResponder { return YES; }
+
+- (NSArray<UIKeyCommand *> *)keyCommands
+{
+    // UIKit requests these very frequently, so only build them once
+    if (_cachedKeyCommands) { return _cachedKeyCommands; }
+
+    NSMutableArray<UIKeyCommand *> *const keyCommands = [NSMutableArray array];
+    void (^addCommand)(NSString *, SEL) = ^(NSString *input, SEL selector) {
+        UIKeyCommand *const command = [UIKeyCommand keyCommandWithInput:input modifierFlags:0 action:selector];
+        if (@available(iOS 15.0, *)) { command.wantsPriorityOverSystemBehavior = YES; }
+        [keyCommands addObject:command];
+    };
+
+    // The arrow keys move in the physical direction, and page up/down in the reading direction
+    addCommand(UIKeyInputLeftArrow, @selector(leftArrowKeyPressed:));
+    addCommand(UIKeyInputRightArrow, @selector(rightArrowKeyPressed:));
+    addCommand(UIKeyInputPageUp, @selector(pageUpKeyPressed:));
+    addCommand(UIKeyInputPageDown, @selector(pageDownKeyPressed:));
+
+    // Jumping to an arbitrary position needs the delegate to update the data source first
+    if (_delegateFlags.delegateWillSkipToPageAtFraction) {
+        if (@available(iOS 13.4, *)) {
+            addCommand(UIKeyInputHome, @selector(homeKeyPressed:));
+            addCommand(UIKeyInputEnd, @selector(endKeyPressed:));
+        }
+        for (NSInteger i = 0; i < 10; i++) {
+            addCommand([NSString stringWithFormat:@"%ld", (long)i], @selector(numberKeyPressed:));
+        }
+    }
+
+    _cachedKeyCommands = keyCommands;
+    return _cachedKeyCommands;
+}
+
+- (void)leftArrowKeyPressed:(UIKeyCommand *)command { [self turnToLeftPageAnimated:YES]; }
+- (void)rightArrowKeyPressed:(UIKeyCommand *)command { [self turnToRightPageAnimated:YES]; }
+- (void)pageUpKeyPressed:(UIKeyCommand *)command { [self turnToPreviousPageAnimated:YES]; }
+- (void)pageDownKeyPressed:(UIKeyCommand *)command { [self turnToNextPageAnimated:YES]; }
+- (void)homeKeyPressed:(UIKeyCommand *)command { [self _skipToPageAtFraction:0.0f]; }
+- (void)endKeyPressed:(UIKeyCommand *)command { [self _skipToPageAtFraction:1.0f]; }
+
+- (void)numberKeyPressed:(UIKeyCommand *)command
+{
+    // Like the number row itself, 1 through 9 are tenths of the way through, and 0 comes after 9 as the end
+    const unichar digit = [command.input characterAtIndex:0];
+    [self _skipToPageAtFraction:(digit == '0') ? 1.0f : (CGFloat)(digit - '0') / 10.0f];
+}
+
+- (void)_skipToPageAtFraction:(CGFloat)fraction TOPAGINGVIEW_OBJC_DIRECT
+{
+    id const delegate = _delegate;
+    if (delegate == nil || !_delegateFlags.delegateWillSkipToPageAtFraction) { return; }
+
+    // Let the delegate move the data source to the new page, and then skip straight to it in one step
+    const TOPagingViewPageType type = _delegateIMPs.willSkipToPageAtFraction(delegate,
+                                                        @selector(pagingView:willSkipToPageAtFraction:), self, fraction);
+    if (type == TOPagingViewPageTypeNext) { [self skipForwardToNewPageAnimated:YES]; }
+    else if (type == TOPagingViewPageTypePrevious) { [self skipBackwardToNewPageAnimated:YES]; }
+}
+
 #pragma mark - Public Accessors -
 
+- (void)resetMetrics
+{
+    memset(&_metrics, 0, sizeof(TOPagingViewMetrics));
+}
+
 - (void)setDataSource:(id<TOPagingViewDataSource>)dataSource
 {
     if (dataSource == _dataSource) { return; }
     _dataSource = dataSource;
+
+    // Resolve the implementation of the data source method so it can be called directly
+    SEL const selector = @selector(pagingView:pageViewForType:currentPageView:);
+    _delegateIMPs.pageViewForType = (__typeof__(_delegateIMPs.pageViewForType))[(NSObject *)dataSource methodForSelector:selector];
+
     if (self.superview) { [self reload]; }
 }
 
@@ -1472,22 +2936,153 @@ static inline void TOPagingViewTransitionOverToPreviousPage(TOPagingView *view)
                                             respondsToSelector:@selector(pagingView:didTurnToPageOfType:)];
     _delegateFlags.delegateDidChangeToPageDirection = [_delegate
                                                        respondsToSelector:@selector(pagingView:didChangeToPageDirection:)];
+    _delegateFlags.delegateDidTurnPagesInBatch = [_delegate
+                                                  respondsToSelector:@selector(pagingView:didTurnPagesInBatch:)];
+    _delegateFlags.delegateWillSkipToPageAtFraction = [_delegate
+                                                       respondsToSelector:@selector(pagingView:willSkipToPageAtFraction:)];
+    _delegateFlags.delegateWillSkipByNumberOfPages = [_delegate
+                                                      respondsToSelector:@selector(pagingView:willSkipByNumberOfPages:)];
+
+    // Resolve the implementations of each method the delegate implements so they can be called directly
+    NSObject *const object = (NSObject *)delegate;
+    _delegateIMPs.willTurnToPage = _delegateFlags.delegateWillTurnToPage ?
+                                    (__typeof__(_delegateIMPs.willTurnToPage))[object methodForSelector:@selector(pagingView:willTurnToPageOfType:)] : NULL;
+    _delegateIMPs.didTurnToPage = _delegateFlags.delegateDidTurnToPage ?
+                                    (__typeof__(_delegateIMPs.didTurnToPage))[object methodForSelector:@selector(pagingView:didTurnToPageOfType:)] : NULL;
+    _delegateIMPs.didChangeToPageDirection = _delegateFlags.delegateDidChangeToPageDirection ?
+                                    (__typeof__(_delegateIMPs.didChangeToPageDirection))[object methodForSelector:@selector(pagingView:didChangeToPageDirection:)] : NULL;
+    _delegateIMPs.didTurnPagesInBatch = _delegateFlags.delegateDidTurnPagesInBatch ?
+                                    (__typeof__(_delegateIMPs.didTurnPagesInBatch))[object methodForSelector:@selector(pagingView:didTurnPagesInBatch:)] : NULL;
+    _delegateIMPs.willSkipToPageAtFraction = _delegateFlags.delegateWillSkipToPageAtFraction ?
+                                    (__typeof__(_delegateIMPs.willSkipToPageAtFraction))[object methodForSelector:@selector(pagingView:willSkipToPageAtFraction:)] : NULL;
+    _delegateIMPs.willSkipByNumberOfPages = _delegateFlags.delegateWillSkipByNumberOfPages ?
+                                    (__typeof__(_delegateIMPs.willSkipByNumberOfPages))[object methodForSelector:@selector(pagingView:willSkipByNumberOfPages:)] : NULL;
+
+    // The available keyboard commands depend on the delegate, so rebuild them next time
+    _cachedKeyCommands = nil;
 }
 
 - (nullable NSSet<__kindof UIView<TOPagingViewPage> *> *)visiblePageViews
 {
-    NSMutableSet *visiblePages = [NSMutableSet set];
-    if (_previousPageView) { [visiblePages addObject:_previousPageView]; }
-    if (_currentPageView) { [visiblePages addObject:_currentPageView]; }
-    if (_nextPageView) { [visiblePages addObject:_nextPageView]; }
+    NSArray *const visiblePages = self.orderedVisiblePageViews;
     if (visiblePages.count == 0) { return nil; }
-    return [NSSet setWithSet:visiblePages];
+    return [NSSet setWithArray:visiblePages];
+}
+
+- (NSArray<__kindof UIView<TOPagingViewPage> *> *)orderedVisiblePageViews
+{
+    // Return the cached array if none of the pages have changed since it was built.
+    // (The array holds strong references to the pages, so these pointers can't be re-used while it's alive)
+    if (_orderedVisiblePageViews != nil
+        && _orderedPreviousPageView == _previousPageView
+        && _orderedCurrentPageView == _currentPageView
+        && _orderedNextPageView == _nextPageView) {
+        return _orderedVisiblePageViews;
+    }
+
+    // Rebuild the array in order, without any intermediate collections
+    UIView *pageViews[3];
+    NSUInteger count = 0;
+    if (_previousPageView) { pageViews[count++] = _previousPageView; }
+    if (_currentPageView) { pageViews[count++] = _currentPageView; }
+    if (_nextPageView) { pageViews[count++] = _nextPageView; }
+
+    _orderedVisiblePageViews = [NSArray arrayWithObjects:pageViews count:count];
+    _orderedPreviousPageView = _previousPageView;
+    _orderedCurrentPageView = _currentPageView;
+    _orderedNextPageView = _nextPageView;
+    return _orderedVisiblePageViews;
+}
+
+- (void)enumerateVisiblePageViewsUsingBlock:(void (NS_NOESCAPE ^)(__kindof UIView<TOPagingViewPage> *,
+                                                                  TOPagingViewPageType,
+                                                                  BOOL *))block
+{
+    if (block == nil) { return; }
+
+    // Walk the slots directly in order, loading each weak reference only once
+    BOOL stop = NO;
+    UIView<TOPagingViewPage> *pageView = _previousPageView;
+    if (pageView) { block(pageView, TOPagingViewPageTypePrevious, &stop); if (stop) { return; } }
+    pageView = _currentPageView;
+    if (pageView) { block(pageView, TOPagingViewPageTypeCurrent, &stop); if (stop) { return; } }
+    pageView = _nextPageView;
+    if (pageView) { block(pageView, TOPagingViewPageTypeNext, &stop); }
+}
+
+- (void)setResourcePolicy:(id<TOPagingViewResourcePolicy>)resourcePolicy
+{
+    if (resourcePolicy == nil) { resourcePolicy = TOPagingViewDefaultResourcePolicy.sharedPolicy; }
+    if (resourcePolicy == _resourcePolicy) { return; }
+
+    NSNotificationCenter *const notificationCenter = [NSNotificationCenter defaultCenter];
+    if (_resourcePolicy) {
+        [notificationCenter removeObserver:self name:TOPagingViewResourcePolicyDidChangeNotification object:_resourcePolicy];
+    }
+    _resourcePolicy = resourcePolicy;
+    [notificationCenter addObserver:self
+                           selector:@selector(_resourcePolicyDidChange:)
+                               name:TOPagingViewResourcePolicyDidChangeNotification
+                             object:resourcePolicy];
+    [self _resourcePolicyDidChange:nil];
+}
+
+- (void)_resourcePolicyDidChange:(nullable NSNotification *)notification
+{
+    _resourceLimits = _resourcePolicy.limits;
+
+    // Apply any new pool capacity straight away
+    for (NSMutableSet *pool in _queuedPages.allValues) {
+        TOPagingViewTrimPagePool(self, pool, _resourceLimits.pagePoolCapacity);
+    }
+}
+
+#pragma mark - App Lifecycle -
+
+- (void)_applicationDidEnterBackground:(NSNotification *)notification
+{
+    if (!_isBackgroundPageReleasingEnabled) { return; }
+
+    // Release the adjacent pages, unless they're part of a transition that is still in progress
+    const BOOL isTransitioning = _disableLayout || _pageViewAnimator.isRunning
+                                    || _outgoingPageView != nil || _skipSnapshotView != nil;
+    if (!isTransitioning) {
+        if (_nextPageView) {
+            TOPagingViewReclaimPageView(self, _nextPageView);
+            _nextPageView = nil;
+            _needsNextPageRestore = YES;
+        }
+        if (_previousPageView) {
+            TOPagingViewReclaimPageView(self, _previousPageView);
+            _previousPageView = nil;
+            _needsPreviousPageRestore = YES;
+        }
+    }
+
+    // Empty the recycled pages pool, including the pages just reclaimed
+    for (NSMutableSet *pool in _queuedPages.allValues) {
+        TOPagingViewTrimPagePool(self, pool, 0);
+    }
+}
+
+- (void)_applicationWillEnterForeground:(NSNotification *)notification
+{
+    if (!_needsNextPageRestore && !_needsPreviousPageRestore) { return; }
+
+    // Defer requesting the pages to the layout passes, which fetch one per pass
+    TOPagingViewBeginTransition(self, TOPagingViewTransitionRestoreAdjacentPages);
+    _needsNextPage = _needsNextPage || _needsNextPageRestore;
+    _needsPreviousPage = _needsPreviousPage || _needsPreviousPageRestore;
+    _needsNextPageRestore = NO;
+    _needsPreviousPageRestore = NO;
+    [self setNeedsLayout];
 }
 
 - (void)setPageScrollDirection:(TOPagingViewDirection)pageScrollDirection
 {
     if (_pageScrollDirection == pageScrollDirection) { return; }
     _pageScrollDirection = pageScrollDirection;
+    TOPagingViewPublishEvent(self, TOPagingViewEventTypeDirectionChange, (int32_t)pageScrollDirection);
     [self _rearrangePagesForScrollDirection:_pageScrollDirection];
 }
 
@@ -1509,6 +3104,17 @@ static inline BOOL TOPagingViewIsDirectionReversed(TOPagingView *view)
     return (view->_pageScrollDirection == TOPagingViewDirectionRightToLeft);
 }
 
+static inline TOPagingViewPageType TOPagingViewPageTypeForEdge(TOPagingView *view, UIRectEdge edge)
+{
+    // When detecting the direction on the initial page, both sides lead to the next page
+    if (view->_isDynamicPageDirectionEnabled && TOPagingViewIsInitialPageForPageView(view, view->_currentPageView)) {
+        return TOPagingViewPageTypeNext;
+    }
+
+    const BOOL isLeftEdge = (edge == UIRectEdgeLeft);
+    return (isLeftEdge != TOPagingViewIsDirectionReversed(view)) ? TOPagingViewPageTypePrevious : TOPagingViewPageTypeNext;
+}
+
 static inline CGRect TOPagingViewScrollViewFrame(TOPagingView *view)
 {
     const CGRect frame = CGRectInset(view.bounds, -(view->_pageSpacing * 0.5f), 0.0f);
@@ -1527,27 +3133,88 @@ static inline CGRect TOPagingViewCurrentPageFrame(TOPagingView *view)
 static inline CGRect TOPagingViewNextPageFrame(TOPagingView *view)
 {
     // Next frame is on the right side when non-reversed,
-    // and on the right side when reversed
-    return TOPagingViewIsDirectionReversed(view) ?
-            TOPagingViewLeftPageFrame(view) : TOPagingViewRightPageFrame(view);
+    // and on the left side when reversed
+    return TOPagingViewFrameForSlot(view, TOPagingViewSlotForPageType(view, TOPagingViewPageTypeNext));
 }
 
 static inline CGRect TOPagingViewPreviousPageFrame(TOPagingView *view)
 {
     // Previous frame is on the left side when non-reversed,
     // and on the right side when reversed
-    return TOPagingViewIsDirectionReversed(view) ?
-            TOPagingViewRightPageFrame(view) : TOPagingViewLeftPageFrame(view);
+    return TOPagingViewFrameForSlot(view, TOPagingViewSlotForPageType(view, TOPagingViewPageTypePrevious));
 }
 
 static inline CGRect TOPagingViewLeftPageFrame(TOPagingView *view)
 {
-    return CGRectOffset(view.bounds, (view->_pageSpacing * 0.5f), 0.0f);
+    return TOPagingViewFrameForSlot(view, TOPagingViewPageSlotLeft);
 }
 
 static inline CGRect TOPagingViewRightPageFrame(TOPagingView *view)
 {
-    return CGRectOffset(view.bounds, (TOPagingViewScrollViewPageWidth(view) * 2.0f) + (view->_pageSpacing * 0.5f), 0.0f);
+    return TOPagingViewFrameForSlot(view, TOPagingViewPageSlotRight);
+}
+
+static inline TOPagingViewPageSlot TOPagingViewSlotForPageType(TOPagingView *view, TOPagingViewPageType type)
+{
+    // The scroll direction is purely a mapping of the next and previous pages onto the outer slots
+    if (type == TOPagingViewPageTypeCurrent) { return TOPagingViewPageSlotCenter; }
+    const BOOL isNextOnLeft = TOPagingViewIsDirectionReversed(view);
+    const BOOL isNext = (type == TOPagingViewPageTypeNext);
+    return (isNext == isNextOnLeft) ? TOPagingViewPageSlotLeft : TOPagingViewPageSlotRight;
+}
+
+static inline CGRect TOPagingViewFrameForSlot(TOPagingView *view, TOPagingViewPageSlot slot)
+{
+    return CGRectOffset(view.bounds, (TOPagingViewScrollViewPageWidth(view) * (CGFloat)slot) + (view->_pageSpacing * 0.5f), 0.0f);
+}
+
+static inline CGPoint TOPagingViewCenterForSlot(TOPagingView *view, TOPagingViewPageSlot slot)
+{
+    const CGRect frame = TOPagingViewFrameForSlot(view, slot);
+    return (CGPoint){CGRectGetMidX(frame), CGRectGetMidY(frame)};
+}
+
+@end
+
+// -----------------------------------------------------------------
+
+@implementation TOPagingViewCoordinator
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _linkedPagingViews = [NSHashTable weakObjectsHashTable];
+    }
+    return self;
+}
+
+- (NSArray<TOPagingView *> *)pagingViews
+{
+    return _linkedPagingViews.allObjects;
+}
+
+- (void)addPagingView:(TOPagingView *)pagingView
+{
+    if (pagingView.coordinator == self) { return; }
+    [pagingView.coordinator removePagingView:pagingView];
+    [_linkedPagingViews addObject:pagingView];
+    pagingView.coordinator = self;
+
+    // The new view's pages now limit where all of the linked views may scroll
+    TOPagingViewUpdatePageSlotsOfLinkedPagingViews(pagingView);
+}
+
+- (void)removePagingView:(TOPagingView *)pagingView
+{
+    if (pagingView.coordinator != self) { return; }
+    [_linkedPagingViews removeObject:pagingView];
+    pagingView.coordinator = nil;
+
+    // Refresh the slots of the view that left, and of the views that may no longer be held back by it
+    TOPagingViewUpdatePageSlots(pagingView);
+    TOPagingView *const remainingPagingView = _linkedPagingViews.anyObject;
+    if (remainingPagingView) { TOPagingViewUpdatePageSlotsOfLinkedPagingViews(remainingPagingView); }
 }
 
 @end
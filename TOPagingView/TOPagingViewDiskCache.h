@@ -0,0 +1,85 @@
+//
+//  TOPagingViewDiskCache.h
+//
+//  Copyright 2023 Timothy Oliver. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to
+//  deal in the Software without restriction, including without limitation the
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+//  sell copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//  WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+//  IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A persistent, size-bounded cache of page content on disk, evicting the least recently used entries first.
+///
+/// Entries are keyed by the same `uniqueIdentifier` strings that pages return, so the cache and paging views
+/// agree on which page is which. Apart from replaying the journal on creation, all disk access happens on a
+/// private serial queue. The index of entries is kept in memory, so checking for an entry is cheap and may be
+/// done from any thread.
+///
+/// Changes to the index are appended to a journal on disk and replayed at launch, so an interrupted write
+/// never leaves a corrupt entry behind. The journal is periodically compacted and atomically swapped in.
+NS_SWIFT_NAME(PagingViewDiskCache)
+@interface TOPagingViewDiskCache : NSObject
+
+/// The directory the cache stores its entries and journal in.
+@property (nonatomic, readonly) NSURL *directoryURL;
+
+/// The most bytes the entries may take up on disk. Least recently used entries are evicted when this is exceeded.
+@property (atomic, assign) NSUInteger byteLimit;
+
+/// The number of bytes the entries currently take up on disk.
+@property (atomic, readonly) NSUInteger totalByteCount;
+
+/// Creates a new cache in the given directory, which is created if needed.
+/// The journal is replayed before this returns, so the index is complete as soon as the cache exists.
+/// Only one cache should use a directory at any one time.
+/// - Parameters:
+///   - directoryURL: The directory to store the cache in.
+///   - byteLimit: The most bytes the entries may take up on disk.
+- (instancetype)initWithDirectoryURL:(NSURL *)directoryURL byteLimit:(NSUInteger)byteLimit NS_DESIGNATED_INITIALIZER;
+
+/// Creates a new cache in the app's caches directory, limited to 100MB.
+- (instancetype)init;
+
+/// Returns whether an entry exists for the key, without touching the disk. This may be called from any thread.
+/// - Parameter key: The unique identifier of the page.
+- (BOOL)containsDataForKey:(NSString *)key;
+
+/// Reads the entry for a key from disk, marking it as recently used.
+/// - Parameters:
+///   - key: The unique identifier of the page.
+///   - completionHandler: Called on the main queue with the data, or nil if there is no entry.
+- (void)dataForKey:(NSString *)key completionHandler:(void (^)(NSData *_Nullable data))completionHandler;
+
+/// Writes an entry to disk, replacing any existing entry for the key, and evicting older entries if needed.
+/// - Parameters:
+///   - data: The data to store.
+///   - key: The unique identifier of the page.
+- (void)setData:(NSData *)data forKey:(NSString *)key;
+
+/// Removes the entry for a key, if one exists.
+/// - Parameter key: The unique identifier of the page.
+- (void)removeDataForKey:(NSString *)key;
+
+/// Removes every entry from the cache.
+- (void)removeAllData;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,383 @@
+//
+//  TOPagingViewDiskCache.m
+//
+//  Copyright 2023 Timothy Oliver. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to
+//  deal in the Software without restriction, including without limitation the
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+//  sell copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//  WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+//  IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#import "TOPagingViewDiskCache.h"
+#import <CommonCrypto/CommonDigest.h>
+#import <os/lock.h>
+#import <fcntl.h>
+#import <unistd.h>
+#import <errno.h>
+
+/// The byte limit used when none is specified.
+static const NSUInteger kTOPagingViewDiskCacheDefaultByteLimit = 100 * 1024 * 1024;
+
+/// The name of the journal file inside the cache directory.
+static NSString * const kTOPagingViewDiskCacheJournalFileName = @"journal";
+
+/// How many more records than entries the journal may hold before it is compacted.
+static const NSUInteger kTOPagingViewDiskCacheJournalSlack = 1000;
+
+/// The journal records. Each is a single line of the record character, the entry's file name, and for stores, its size.
+/// A line cut short by a crash has no newline, and is ignored when the journal is replayed.
+static const char kTOPagingViewDiskCacheStoreRecord = 'S';
+static const char kTOPagingViewDiskCacheReadRecord = 'R';
+static const char kTOPagingViewDiskCacheRemoveRecord = 'D';
+
+// -----------------------------------------------------------------
+
+/// Hashes a key into a fixed-length file name, so any string can be used as a key.
+static NSString *TOPagingViewDiskCacheFileNameForKey(NSString *key)
+{
+    static const char hexDigits[] = "0123456789abcdef";
+    const char *const string = key.UTF8String;
+
+    unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256(string, (CC_LONG)strlen(string), digest);
+
+    char fileName[CC_SHA256_DIGEST_LENGTH * 2 + 1];
+    for (NSUInteger i = 0; i < CC_SHA256_DIGEST_LENGTH; i++) {
+        fileName[i * 2] = hexDigits[digest[i] >> 4];
+        fileName[i * 2 + 1] = hexDigits[digest[i] & 0xF];
+    }
+    fileName[CC_SHA256_DIGEST_LENGTH * 2] = '\0';
+    return [NSString stringWithUTF8String:fileName];
+}
+
+// -----------------------------------------------------------------
+
+@implementation TOPagingViewDiskCache {
+    /// The serial queue all disk access is performed on.
+    dispatch_queue_t _queue;
+
+    /// Guards the entry sizes, total byte count and byte limit, which may be accessed from any thread.
+    os_unfair_lock _lock;
+
+    /// The size of every entry on disk, keyed by its file name.
+    NSMutableDictionary<NSString *, NSNumber *> *_entrySizes;
+    NSUInteger _totalByteCount;
+    NSUInteger _byteLimit;
+
+    /// Every entry's file name, from least to most recently used. Only accessed on the queue.
+    NSMutableOrderedSet<NSString *> *_recentFileNames;
+
+    /// The open journal file, and how many records it holds. Only accessed on the queue.
+    int _journalFileDescriptor;
+    NSUInteger _journalRecordCount;
+
+    /// Set when a record couldn't be fully written, so the journal must be rewritten before anything more is appended.
+    BOOL _needsJournalRebuild;
+}
+
+- (instancetype)init
+{
+    NSURL *const cachesURL = [[NSFileManager defaultManager] URLsForDirectory:NSCachesDirectory inDomains:NSUserDomainMask].firstObject;
+    return [self initWithDirectoryURL:[cachesURL URLByAppendingPathComponent:@"TOPagingViewDiskCache" isDirectory:YES]
+                            byteLimit:kTOPagingViewDiskCacheDefaultByteLimit];
+}
+
+- (instancetype)initWithDirectoryURL:(NSURL *)directoryURL byteLimit:(NSUInteger)byteLimit
+{
+    self = [super init];
+    if (self) {
+        _directoryURL = directoryURL;
+        _byteLimit = byteLimit;
+        _queue = dispatch_queue_create("dev.tim.TOPagingViewDiskCache", DISPATCH_QUEUE_SERIAL);
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _entrySizes = [NSMutableDictionary dictionary];
+        _recentFileNames = [NSMutableOrderedSet orderedSet];
+        _journalFileDescriptor = -1;
+
+        // Replay the journal before returning, so the index is complete before anything can query it.
+        // Nothing else can reach the cache yet, so this doesn't need to happen on the queue.
+        [self _loadJournal];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    // Any queued work retains the cache, so nothing else can be using the journal by now
+    if (_journalFileDescriptor >= 0) { close(_journalFileDescriptor); }
+}
+
+#pragma mark - Public Interface -
+
+- (BOOL)containsDataForKey:(NSString *)key
+{
+    NSString *const fileName = TOPagingViewDiskCacheFileNameForKey(key);
+    os_unfair_lock_lock(&_lock);
+    const BOOL containsData = (_entrySizes[fileName] != nil);
+    os_unfair_lock_unlock(&_lock);
+    return containsData;
+}
+
+- (void)dataForKey:(NSString *)key completionHandler:(void (^)(NSData *_Nullable))completionHandler
+{
+    NSString *const fileName = TOPagingViewDiskCacheFileNameForKey(key);
+    dispatch_async(_queue, ^{
+        NSData *data = nil;
+        if ([self->_recentFileNames containsObject:fileName]) {
+            data = [NSData dataWithContentsOfURL:[self _fileURLForFileName:fileName]
+                                         options:NSDataReadingMappedIfSafe
+                                           error:nil];
+
+            // Mark it as the most recently used, or forget it if the file has gone missing
+            if (data) {
+                [self->_recentFileNames removeObject:fileName];
+                [self->_recentFileNames addObject:fileName];
+                [self _appendRecord:kTOPagingViewDiskCacheReadRecord fileName:fileName size:0];
+            } else {
+                [self _removeEntryWithFileName:fileName];
+            }
+        }
+        dispatch_async(dispatch_get_main_queue(), ^{ completionHandler(data); });
+    });
+}
+
+- (void)setData:(NSData *)data forKey:(NSString *)key
+{
+    NSString *const fileName = TOPagingViewDiskCacheFileNameForKey(key);
+    dispatch_async(_queue, ^{
+        // Skip entries that could never fit
+        if (data.length > self.byteLimit) {
+            [self _removeEntryWithFileName:fileName];
+            return;
+        }
+
+        // Write the file fully before recording it, so the journal never refers to a partial file
+        if (![data writeToURL:[self _fileURLForFileName:fileName] options:NSDataWritingAtomic error:nil]) { return; }
+
+        [self _setSize:data.length forFileName:fileName];
+        [self->_recentFileNames removeObject:fileName];
+        [self->_recentFileNames addObject:fileName];
+        [self _appendRecord:kTOPagingViewDiskCacheStoreRecord fileName:fileName size:data.length];
+        [self _evictEntriesIfNeeded];
+    });
+}
+
+- (void)removeDataForKey:(NSString *)key
+{
+    NSString *const fileName = TOPagingViewDiskCacheFileNameForKey(key);
+    dispatch_async(_queue, ^{
+        [self _removeEntryWithFileName:fileName];
+    });
+}
+
+- (void)removeAllData
+{
+    dispatch_async(_queue, ^{
+        for (NSString *fileName in self->_recentFileNames.array) {
+            [[NSFileManager defaultManager] removeItemAtURL:[self _fileURLForFileName:fileName] error:nil];
+        }
+
+        os_unfair_lock_lock(&self->_lock);
+        [self->_entrySizes removeAllObjects];
+        self->_totalByteCount = 0;
+        os_unfair_lock_unlock(&self->_lock);
+
+        [self->_recentFileNames removeAllObjects];
+        [self _compactJournal];
+    });
+}
+
+- (void)setByteLimit:(NSUInteger)byteLimit
+{
+    os_unfair_lock_lock(&_lock);
+    _byteLimit = byteLimit;
+    os_unfair_lock_unlock(&_lock);
+
+    // Apply a lower limit straight away, rather than waiting for the next write
+    dispatch_async(_queue, ^{ [self _evictEntriesIfNeeded]; });
+}
+
+- (NSUInteger)byteLimit
+{
+    os_unfair_lock_lock(&_lock);
+    const NSUInteger byteLimit = _byteLimit;
+    os_unfair_lock_unlock(&_lock);
+    return byteLimit;
+}
+
+- (NSUInteger)totalByteCount
+{
+    os_unfair_lock_lock(&_lock);
+    const NSUInteger totalByteCount = _totalByteCount;
+    os_unfair_lock_unlock(&_lock);
+    return totalByteCount;
+}
+
+#pragma mark - Entries -
+
+- (NSURL *)_fileURLForFileName:(NSString *)fileName
+{
+    return [_directoryURL URLByAppendingPathComponent:fileName isDirectory:NO];
+}
+
+- (void)_setSize:(NSUInteger)size forFileName:(NSString *)fileName
+{
+    os_unfair_lock_lock(&_lock);
+    _totalByteCount -= _entrySizes[fileName].unsignedIntegerValue;
+    _totalByteCount += size;
+    _entrySizes[fileName] = @(size);
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (void)_removeEntryWithFileName:(NSString *)fileName
+{
+    if (![_recentFileNames containsObject:fileName]) { return; }
+
+    // Record the removal first, so a crash can only ever leave an orphaned file, which is cleaned up on the next load
+    [self _appendRecord:kTOPagingViewDiskCacheRemoveRecord fileName:fileName size:0];
+    [_recentFileNames removeObject:fileName];
+
+    os_unfair_lock_lock(&_lock);
+    _totalByteCount -= _entrySizes[fileName].unsignedIntegerValue;
+    [_entrySizes removeObjectForKey:fileName];
+    os_unfair_lock_unlock(&_lock);
+
+    [[NSFileManager defaultManager] removeItemAtURL:[self _fileURLForFileName:fileName] error:nil];
+}
+
+- (void)_evictEntriesIfNeeded
+{
+    const NSUInteger byteLimit = self.byteLimit;
+    while (self.totalByteCount > byteLimit && _recentFileNames.count > 0) {
+        [self _removeEntryWithFileName:_recentFileNames.firstObject];
+    }
+}
+
+#pragma mark - Journal -
+
+- (void)_loadJournal
+{
+    NSFileManager *const fileManager = [NSFileManager defaultManager];
+    [fileManager createDirectoryAtURL:_directoryURL withIntermediateDirectories:YES attributes:nil error:nil];
+
+    // Find every file actually on disk, with its size
+    NSMutableDictionary<NSString *, NSNumber *> *const fileSizes = [NSMutableDictionary dictionary];
+    NSArray<NSURL *> *const fileURLs = [fileManager contentsOfDirectoryAtURL:_directoryURL
+                                                  includingPropertiesForKeys:@[NSURLFileSizeKey]
+                                                                     options:NSDirectoryEnumerationSkipsHiddenFiles
+                                                                       error:nil];
+    for (NSURL *fileURL in fileURLs) {
+        NSNumber *fileSize = nil;
+        [fileURL getResourceValue:&fileSize forKey:NSURLFileSizeKey error:nil];
+        fileSizes[fileURL.lastPathComponent] = fileSize ?: @0;
+    }
+    [fileSizes removeObjectForKey:kTOPagingViewDiskCacheJournalFileName];
+
+    // Replay every complete record in the journal to rebuild the order the entries were used in
+    NSData *const journalData = [NSData dataWithContentsOfURL:[self _fileURLForFileName:kTOPagingViewDiskCacheJournalFileName]];
+    NSString *const journal = journalData ? [[NSString alloc] initWithData:journalData encoding:NSUTF8StringEncoding] : nil;
+    NSArray<NSString *> *const lines = [journal componentsSeparatedByString:@"\n"];
+    for (NSUInteger i = 0; i + 1 < lines.count; i++) {
+        NSArray<NSString *> *const components = [lines[i] componentsSeparatedByString:@" "];
+        if (components.count < 2 || components[0].length != 1) { continue; }
+
+        const char record = (char)[components[0] characterAtIndex:0];
+        NSString *const fileName = components[1];
+        if (record == kTOPagingViewDiskCacheRemoveRecord) {
+            [_recentFileNames removeObject:fileName];
+        } else if (record == kTOPagingViewDiskCacheStoreRecord || record == kTOPagingViewDiskCacheReadRecord) {
+            [_recentFileNames removeObject:fileName];
+            [_recentFileNames addObject:fileName];
+        }
+    }
+
+    // Only keep entries whose files exist, and delete any files the journal doesn't know about
+    for (NSString *fileName in [_recentFileNames.array copy]) {
+        NSNumber *const fileSize = fileSizes[fileName];
+        if (fileSize == nil) { [_recentFileNames removeObject:fileName]; continue; }
+        [self _setSize:fileSize.unsignedIntegerValue forFileName:fileName];
+        [fileSizes removeObjectForKey:fileName];
+    }
+    for (NSString *fileName in fileSizes) {
+        [fileManager removeItemAtURL:[self _fileURLForFileName:fileName] error:nil];
+    }
+
+    // Start with a fresh journal holding only the live entries, and apply the limit in case it was lowered
+    [self _compactJournal];
+    [self _evictEntriesIfNeeded];
+}
+
+- (void)_compactJournal
+{
+    // Write out one store record per entry, oldest first, so replaying it rebuilds the same order
+    NSMutableString *const journal = [NSMutableString string];
+    os_unfair_lock_lock(&_lock);
+    for (NSString *fileName in _recentFileNames) {
+        [journal appendFormat:@"%c %@ %lu\n", kTOPagingViewDiskCacheStoreRecord, fileName,
+                                (unsigned long)_entrySizes[fileName].unsignedIntegerValue];
+    }
+    os_unfair_lock_unlock(&_lock);
+
+    // Atomically replace the old journal, so a crash leaves either the old or new one intact
+    if (_journalFileDescriptor >= 0) { close(_journalFileDescriptor); }
+    NSURL *const journalURL = [self _fileURLForFileName:kTOPagingViewDiskCacheJournalFileName];
+    const BOOL didWrite = [[journal dataUsingEncoding:NSUTF8StringEncoding] writeToURL:journalURL
+                                                                               options:NSDataWritingAtomic
+                                                                                 error:nil];
+
+    // If the old journal is still in place, it may end in a partial record, so keep retrying the rewrite rather than appending
+    _needsJournalRebuild = !didWrite;
+    _journalFileDescriptor = didWrite ? open(journalURL.fileSystemRepresentation, O_WRONLY | O_APPEND | O_CREAT, 0644) : -1;
+    _journalRecordCount = _recentFileNames.count;
+}
+
+- (void)_appendRecord:(char)record fileName:(NSString *)fileName size:(NSUInteger)size
+{
+    // A rewrite captures the entries as they are now. A removal is recorded before its entry is dropped, but the
+    // entry's file is deleted straight after, so replaying the rewritten journal drops it anyway.
+    if (_needsJournalRebuild) {
+        [self _compactJournal];
+        return;
+    }
+    if (_journalFileDescriptor < 0) { return; }
+
+    char line[128];
+    const int length = (record == kTOPagingViewDiskCacheStoreRecord) ?
+                            snprintf(line, sizeof(line), "%c %s %lu\n", record, fileName.UTF8String, (unsigned long)size) :
+                            snprintf(line, sizeof(line), "%c %s\n", record, fileName.UTF8String);
+    if (length <= 0 || length >= (int)sizeof(line)) { return; }
+
+    // Finish any short write. If the disk is full or the write fails, the journal may now end in a partial record
+    // that the next append would run into, so rewrite it from the index instead.
+    ssize_t writtenLength = 0;
+    while (writtenLength < length) {
+        const ssize_t result = write(_journalFileDescriptor, line + writtenLength, (size_t)(length - writtenLength));
+        if (result < 0 && errno == EINTR) { continue; }
+        if (result <= 0) { break; }
+        writtenLength += result;
+    }
+    if (writtenLength < length) {
+        [self _compactJournal];
+        return;
+    }
+
+    // Compact once the journal is mostly made up of stale records
+    if (++_journalRecordCount > _recentFileNames.count * 2 + kTOPagingViewDiskCacheJournalSlack) {
+        [self _compactJournal];
+    }
+}
+
+@end
@@ -0,0 +1,101 @@
+//
+//  TOPagingViewEventRing.h
+//
+//  Copyright 2023 Timothy Oliver. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to
+//  deal in the Software without restriction, including without limitation the
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+//  sell copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//  WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+//  IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The kinds of events a paging view may publish to an event ring.
+typedef NS_ENUM(uint8_t, TOPagingViewEventType) {
+    /// The user turned to the next page. The value is 1.
+    TOPagingViewEventTypeTurnToNextPage,
+
+    /// The user turned to the previous page. The value is -1.
+    TOPagingViewEventTypeTurnToPreviousPage,
+
+    /// The paging view skipped to a new page. The value is 1 when skipping forward, and -1 when skipping backward.
+    TOPagingViewEventTypeSkip,
+
+    /// The paging view was reloaded from scratch. The value is 0.
+    TOPagingViewEventTypeReload,
+
+    /// The page scroll direction changed. The value is the new `TOPagingViewDirection`.
+    TOPagingViewEventTypeDirectionChange
+} NS_SWIFT_NAME(PagingViewEventType);
+
+/// A compact record of something that happened in a paging view.
+typedef struct TOPagingViewEvent {
+    /// The time the event occurred, in the same time base as `CACurrentMediaTime()`.
+    CFTimeInterval timestamp;
+
+    /// An additional value describing the event, whose meaning depends on the type.
+    int32_t value;
+
+    /// The kind of event that occurred.
+    TOPagingViewEventType type;
+} TOPagingViewEvent NS_SWIFT_NAME(PagingViewEvent);
+
+/// A fixed-size, lock-free ring buffer that paging views publish events into from the main thread,
+/// and that a single consumer on any other thread may drain at its own pace.
+///
+/// Publishing never blocks and never allocates. If the consumer falls behind and the ring fills up,
+/// new events are dropped and counted in `overflowCount` instead.
+NS_SWIFT_NAME(PagingViewEventRing)
+@interface TOPagingViewEventRing : NSObject
+
+/// The maximum number of undrained events the ring can hold.
+@property (nonatomic, readonly) NSUInteger capacity;
+
+/// The number of events that were dropped because the ring was full. Safe to read from any thread.
+@property (nonatomic, readonly) NSUInteger overflowCount;
+
+/// Creates a new ring able to hold the given number of events (rounded up to the next power of two).
+/// Returns nil if the memory for the ring couldn't be allocated.
+/// - Parameter capacity: The minimum number of events the ring should be able to hold.
+- (nullable instancetype)initWithCapacity:(NSUInteger)capacity NS_DESIGNATED_INITIALIZER;
+
+/// Creates a new ring with a default capacity of 256 events, or nil if its memory couldn't be allocated.
+- (nullable instancetype)init;
+
+/// Adds an event to the ring. This must only be called from one thread (the main thread, for paging views).
+/// - Parameter event: The event to add.
+/// - Returns: NO if the ring was full and the event was dropped.
+- (BOOL)publishEvent:(TOPagingViewEvent)event;
+
+/// Removes up to the given number of the oldest events from the ring, and copies them into the buffer.
+/// This must only be called from one consumer thread at a time.
+/// - Parameters:
+///   - buffer: The buffer to copy the events into.
+///   - maximumCount: The number of events the buffer can hold.
+/// - Returns: The number of events copied into the buffer.
+- (NSUInteger)drainEventsIntoBuffer:(TOPagingViewEvent *)buffer maximumCount:(NSUInteger)maximumCount;
+
+/// Removes all of the events currently in the ring, passing each one to the block, oldest first.
+/// This must only be called from one consumer thread at a time.
+/// - Parameter block: The block to call with each event.
+/// - Returns: The number of events drained.
+- (NSUInteger)drainEventsUsingBlock:(void (NS_NOESCAPE ^)(TOPagingViewEvent event))block;
+
+@end
+
+NS_ASSUME_NONNULL_END
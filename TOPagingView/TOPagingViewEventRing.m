@@ -0,0 +1,142 @@
+//
+//  TOPagingViewEventRing.m
+//
+//  Copyright 2023 Timothy Oliver. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to
+//  deal in the Software without restriction, including without limitation the
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+//  sell copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//  WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+//  IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#import "TOPagingViewEventRing.h"
+#import <stdatomic.h>
+
+/// The capacity used when none is specified.
+static const NSUInteger kTOPagingViewEventRingDefaultCapacity = 256;
+
+/// The size of a cache line, used to keep the producer and consumer indices from sharing one.
+#define TOPAGINGVIEW_CACHE_LINE_SIZE 64
+
+/// The state shared between the producer and consumer threads. The indices only ever increase,
+/// and are masked to find their slot, so a full ring can be told apart from an empty one.
+typedef struct {
+    _Alignas(TOPAGINGVIEW_CACHE_LINE_SIZE) _Atomic(uint64_t) writeIndex;
+    _Alignas(TOPAGINGVIEW_CACHE_LINE_SIZE) _Atomic(uint64_t) readIndex;
+    _Alignas(TOPAGINGVIEW_CACHE_LINE_SIZE) _Atomic(uint64_t) overflowCount;
+} TOPagingViewEventRingIndices;
+
+// -----------------------------------------------------------------
+
+@implementation TOPagingViewEventRing {
+    TOPagingViewEventRingIndices *_indices;
+    TOPagingViewEvent *_events;
+    uint64_t _mask;
+}
+
+- (nullable instancetype)init
+{
+    return [self initWithCapacity:kTOPagingViewEventRingDefaultCapacity];
+}
+
+- (nullable instancetype)initWithCapacity:(NSUInteger)capacity
+{
+    self = [super init];
+    if (self) {
+        // Round up to a power of two so indices can be masked instead of divided
+        NSUInteger roundedCapacity = 1;
+        while (roundedCapacity < MAX(capacity, (NSUInteger)1)) { roundedCapacity <<= 1; }
+        _capacity = roundedCapacity;
+        _mask = roundedCapacity - 1;
+
+        _events = calloc(roundedCapacity, sizeof(TOPagingViewEvent));
+        if (posix_memalign((void **)&_indices, TOPAGINGVIEW_CACHE_LINE_SIZE, sizeof(TOPagingViewEventRingIndices)) != 0) {
+            _indices = NULL;
+        }
+        if (_events == NULL || _indices == NULL) { return nil; }
+
+        atomic_init(&_indices->writeIndex, 0);
+        atomic_init(&_indices->readIndex, 0);
+        atomic_init(&_indices->overflowCount, 0);
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    free(_events);
+    free(_indices);
+}
+
+#pragma mark - Producer -
+
+- (BOOL)publishEvent:(TOPagingViewEvent)event
+{
+    // Only this thread writes the write index, so it can be read without any ordering
+    const uint64_t writeIndex = atomic_load_explicit(&_indices->writeIndex, memory_order_relaxed);
+    const uint64_t readIndex = atomic_load_explicit(&_indices->readIndex, memory_order_acquire);
+
+    // If the consumer has fallen behind, drop the event rather than block
+    if (writeIndex - readIndex >= _capacity) {
+        atomic_fetch_add_explicit(&_indices->overflowCount, 1, memory_order_relaxed);
+        return NO;
+    }
+
+    // Write the event, and then publish it to the consumer
+    _events[writeIndex & _mask] = event;
+    atomic_store_explicit(&_indices->writeIndex, writeIndex + 1, memory_order_release);
+    return YES;
+}
+
+#pragma mark - Consumer -
+
+- (NSUInteger)drainEventsIntoBuffer:(TOPagingViewEvent *)buffer maximumCount:(NSUInteger)maximumCount
+{
+    const uint64_t readIndex = atomic_load_explicit(&_indices->readIndex, memory_order_relaxed);
+    const uint64_t writeIndex = atomic_load_explicit(&_indices->writeIndex, memory_order_acquire);
+    const NSUInteger count = (NSUInteger)MIN(writeIndex - readIndex, (uint64_t)maximumCount);
+
+    for (NSUInteger i = 0; i < count; i++) {
+        buffer[i] = _events[(readIndex + i) & _mask];
+    }
+
+    // Release the slots back to the producer once they've been copied out
+    atomic_store_explicit(&_indices->readIndex, readIndex + count, memory_order_release);
+    return count;
+}
+
+- (NSUInteger)drainEventsUsingBlock:(void (NS_NOESCAPE ^)(TOPagingViewEvent event))block
+{
+    const uint64_t readIndex = atomic_load_explicit(&_indices->readIndex, memory_order_relaxed);
+    const uint64_t writeIndex = atomic_load_explicit(&_indices->writeIndex, memory_order_acquire);
+
+    // Release each slot as soon as it has been copied out, so the producer isn't held up by the block
+    for (uint64_t index = readIndex; index < writeIndex; index++) {
+        const TOPagingViewEvent event = _events[index & _mask];
+        atomic_store_explicit(&_indices->readIndex, index + 1, memory_order_release);
+        block(event);
+    }
+
+    return (NSUInteger)(writeIndex - readIndex);
+}
+
+#pragma mark - Accessors -
+
+- (NSUInteger)overflowCount
+{
+    return (NSUInteger)atomic_load_explicit(&_indices->overflowCount, memory_order_relaxed);
+}
+
+@end
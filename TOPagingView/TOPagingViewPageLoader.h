@@ -0,0 +1,106 @@
+//
+//  TOPagingViewPageLoader.h
+//
+//  Copyright 2023 Timothy Oliver. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to
+//  deal in the Software without restriction, including without limitation the
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+//  sell copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//  WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+//  IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+#import "TOPagingViewResourcePolicy.h"
+#import "TOPagingViewDiskCache.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The block called when a page loader request finishes. It is always called on the main queue.
+typedef void (^TOPagingViewPageLoaderCompletionHandler)(NSData *_Nullable data, NSError *_Nullable error);
+
+/// An optional component for loading page content over the network, designed around the lifecycle of the pages in a paging view.
+///
+/// Concurrent requests for the same URL are merged into one, requests are started in order of how close their pages are
+/// to the current page, and no more requests run at once than the resource policy allows. When assigned to a paging view's
+/// `pageLoader` property, request priorities follow pages as they move between slots, and any requests belonging to a
+/// page are cancelled as soon as the paging view recycles it.
+///
+/// This class must only be used from the main thread.
+NS_SWIFT_NAME(PagingViewPageLoader)
+@interface TOPagingViewPageLoader : NSObject
+
+/// The session the requests are performed on.
+@property (nonatomic, readonly) NSURLSession *session;
+
+/// The policy deciding how many requests may run at once. Defaults to the shared `TOPagingViewDefaultResourcePolicy`.
+@property (nonatomic, strong, null_resettable) id<TOPagingViewResourcePolicy> resourcePolicy;
+
+/// An optional cache that requests with a cache key are read from before going to the network, and written back to after.
+@property (nonatomic, strong, nullable) TOPagingViewDiskCache *diskCache;
+
+/// The number of requests currently running.
+@property (nonatomic, readonly) NSUInteger numberOfActiveRequests;
+
+/// The number of requests waiting for a running request to finish before they can start.
+@property (nonatomic, readonly) NSUInteger numberOfPendingRequests;
+
+/// Creates a new loader with the given session configuration (eg, one pointed at a local server for testing).
+/// - Parameter configuration: The configuration used to create the loader's session.
+- (instancetype)initWithSessionConfiguration:(NSURLSessionConfiguration *)configuration NS_DESIGNATED_INITIALIZER;
+
+/// Creates a new loader using the default session configuration.
+- (instancetype)init;
+
+/// Loads the data at a URL on behalf of an owner (usually the page view that will display it). If the URL
+/// is already being loaded, the existing request is shared instead of starting a new one.
+/// - Parameters:
+///   - url: The URL to load.
+///   - owner: The object the request belongs to. It isn't retained, and its requests may be cancelled together.
+///   - distance: How many slots away from the current page the owner is (eg, 0 for the current page, 1 for an adjacent one).
+///   - completionHandler: Called on the main queue when the data has loaded, or failed to load. It isn't called if the request is cancelled.
+- (void)loadURL:(NSURL *)url
+       forOwner:(id)owner
+       distance:(NSUInteger)distance
+completionHandler:(TOPagingViewPageLoaderCompletionHandler)completionHandler;
+
+/// Loads the data at a URL as above, but checks the disk cache for it first, and stores it there once loaded.
+/// - Parameters:
+///   - url: The URL to load.
+///   - cacheKey: The key the data is cached under. Use the `uniqueIdentifier` of the page it is for.
+///   - owner: The object the request belongs to. It isn't retained, and its requests may be cancelled together.
+///   - distance: How many slots away from the current page the owner is (eg, 0 for the current page, 1 for an adjacent one).
+///   - completionHandler: Called on the main queue when the data has loaded, or failed to load. It isn't called if the request is cancelled.
+- (void)loadURL:(NSURL *)url
+       cacheKey:(nullable NSString *)cacheKey
+       forOwner:(id)owner
+       distance:(NSUInteger)distance
+completionHandler:(TOPagingViewPageLoaderCompletionHandler)completionHandler;
+
+/// Updates the distance of all of the requests belonging to an owner, changing the order they will be started in.
+/// - Parameters:
+///   - distance: How many slots away from the current page the owner now is.
+///   - owner: The object the requests belong to.
+- (void)setDistance:(NSUInteger)distance forOwner:(id)owner;
+
+/// Cancels all of the requests belonging to an owner. Any request still wanted by another owner keeps running.
+/// - Parameter owner: The object the requests belong to.
+- (void)cancelRequestsForOwner:(id)owner;
+
+/// Cancels every request, whichever owner it belongs to.
+- (void)cancelAllRequests;
+
+@end
+
+NS_ASSUME_NONNULL_END
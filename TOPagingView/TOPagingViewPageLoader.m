@@ -0,0 +1,323 @@
+//
+//  TOPagingViewPageLoader.m
+//
+//  Copyright 2023 Timothy Oliver. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to
+//  deal in the Software without restriction, including without limitation the
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+//  sell copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//  WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+//  IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#import "TOPagingViewPageLoader.h"
+
+/// A single caller waiting on a request.
+@interface TOPagingViewPageLoaderSubscriber : NSObject
+@property (nonatomic, weak) id owner;
+@property (nonatomic, assign) NSUInteger distance;
+@property (nonatomic, copy) TOPagingViewPageLoaderCompletionHandler completionHandler;
+@end
+
+@implementation TOPagingViewPageLoaderSubscriber
+@end
+
+// -----------------------------------------------------------------
+
+/// A request for a single URL, shared between every caller that asked for it.
+@interface TOPagingViewPageLoaderRequest : NSObject
+@property (nonatomic, strong) NSURL *url;
+@property (nonatomic, copy, nullable) NSString *cacheKey;
+@property (nonatomic, strong, nullable) NSURLSessionDataTask *task;
+@property (nonatomic, assign) BOOL isReadingFromCache;
+@property (nonatomic, strong) NSMutableArray<TOPagingViewPageLoaderSubscriber *> *subscribers;
+@end
+
+@implementation TOPagingViewPageLoaderRequest
+
+- (NSUInteger)distance
+{
+    // The request is as urgent as the closest page still waiting on it
+    NSUInteger distance = NSUIntegerMax;
+    for (TOPagingViewPageLoaderSubscriber *subscriber in _subscribers) {
+        distance = MIN(distance, subscriber.distance);
+    }
+    return distance;
+}
+
+@end
+
+// -----------------------------------------------------------------
+
+static inline float TOPagingViewPageLoaderTaskPriorityForDistance(NSUInteger distance)
+{
+    switch (distance) {
+        case 0: return NSURLSessionTaskPriorityHigh;
+        case 1: return NSURLSessionTaskPriorityDefault;
+        default: return NSURLSessionTaskPriorityLow;
+    }
+}
+
+// -----------------------------------------------------------------
+
+@implementation TOPagingViewPageLoader {
+    /// All of the active and pending requests, keyed by their URL.
+    NSMutableDictionary<NSURL *, TOPagingViewPageLoaderRequest *> *_requests;
+}
+
+- (instancetype)init
+{
+    return [self initWithSessionConfiguration:[NSURLSessionConfiguration defaultSessionConfiguration]];
+}
+
+- (instancetype)initWithSessionConfiguration:(NSURLSessionConfiguration *)configuration
+{
+    self = [super init];
+    if (self) {
+        // Deliver every completion on the main queue, so no state here is ever touched from another thread
+        _session = [NSURLSession sessionWithConfiguration:configuration delegate:nil delegateQueue:[NSOperationQueue mainQueue]];
+        _requests = [NSMutableDictionary dictionary];
+        [self setResourcePolicy:nil];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    [_session invalidateAndCancel];
+}
+
+#pragma mark - Requests -
+
+- (void)loadURL:(NSURL *)url
+       forOwner:(id)owner
+       distance:(NSUInteger)distance
+completionHandler:(TOPagingViewPageLoaderCompletionHandler)completionHandler
+{
+    [self loadURL:url cacheKey:nil forOwner:owner distance:distance completionHandler:completionHandler];
+}
+
+- (void)loadURL:(NSURL *)url
+       cacheKey:(nullable NSString *)cacheKey
+       forOwner:(id)owner
+       distance:(NSUInteger)distance
+completionHandler:(TOPagingViewPageLoaderCompletionHandler)completionHandler
+{
+    TOPagingViewPageLoaderSubscriber *const subscriber = [TOPagingViewPageLoaderSubscriber new];
+    subscriber.owner = owner;
+    subscriber.distance = distance;
+    subscriber.completionHandler = completionHandler;
+
+    // If this URL is already being loaded, wait on that request instead of starting another one
+    TOPagingViewPageLoaderRequest *request = _requests[url];
+    if (request) {
+        [request.subscribers addObject:subscriber];
+        request.task.priority = TOPagingViewPageLoaderTaskPriorityForDistance(request.distance);
+        return;
+    }
+
+    request = [TOPagingViewPageLoaderRequest new];
+    request.url = url;
+    request.cacheKey = cacheKey;
+    request.subscribers = [NSMutableArray arrayWithObject:subscriber];
+    _requests[url] = request;
+
+    // If the data is already cached, read it from disk instead (This is a cheap, in-memory check)
+    if (cacheKey && [_diskCache containsDataForKey:cacheKey]) {
+        [self _readRequestFromDiskCache:request];
+        return;
+    }
+
+    [self _startPendingRequestsIfNeeded];
+}
+
+- (void)_readRequestFromDiskCache:(TOPagingViewPageLoaderRequest *)request
+{
+    // Mark the request as in progress so it isn't also started on the network
+    request.isReadingFromCache = YES;
+
+    __weak typeof(self) weakSelf = self;
+    __weak TOPagingViewPageLoaderRequest *weakRequest = request;
+    [_diskCache dataForKey:request.cacheKey completionHandler:^(NSData *data) {
+        TOPagingViewPageLoader *const strongSelf = weakSelf;
+        TOPagingViewPageLoaderRequest *const strongRequest = weakRequest;
+        if (strongSelf == nil || strongRequest == nil) { return; }
+        strongRequest.isReadingFromCache = NO;
+
+        // If the entry was evicted in the meantime, fall back to the network
+        if (data == nil) {
+            [strongSelf _startPendingRequestsIfNeeded];
+            return;
+        }
+        [strongSelf _request:strongRequest didCompleteWithData:data response:nil error:nil];
+    }];
+}
+
+- (void)setDistance:(NSUInteger)distance forOwner:(id)owner
+{
+    for (TOPagingViewPageLoaderRequest *request in _requests.allValues) {
+        BOOL isChanged = NO;
+        for (TOPagingViewPageLoaderSubscriber *subscriber in request.subscribers) {
+            if (subscriber.owner != owner) { continue; }
+            subscriber.distance = distance;
+            isChanged = YES;
+        }
+        if (isChanged) { request.task.priority = TOPagingViewPageLoaderTaskPriorityForDistance(request.distance); }
+    }
+}
+
+- (void)cancelRequestsForOwner:(id)owner
+{
+    for (TOPagingViewPageLoaderRequest *request in _requests.allValues) {
+        // Drop this owner, along with any owners that have since been deallocated
+        NSIndexSet *const indexes = [request.subscribers indexesOfObjectsPassingTest:^BOOL(TOPagingViewPageLoaderSubscriber *subscriber, NSUInteger idx, BOOL *stop) {
+            id const subscriberOwner = subscriber.owner;
+            return subscriberOwner == nil || subscriberOwner == owner;
+        }];
+        if (indexes.count == 0) { continue; }
+        [request.subscribers removeObjectsAtIndexes:indexes];
+
+        // Only cancel the request itself once nobody is waiting on it any more
+        if (request.subscribers.count > 0) {
+            request.task.priority = TOPagingViewPageLoaderTaskPriorityForDistance(request.distance);
+            continue;
+        }
+        [request.task cancel];
+        [_requests removeObjectForKey:request.url];
+    }
+
+    // Fill any slots freed up by cancelled requests
+    [self _startPendingRequestsIfNeeded];
+}
+
+- (void)cancelAllRequests
+{
+    for (TOPagingViewPageLoaderRequest *request in _requests.allValues) {
+        [request.task cancel];
+    }
+    [_requests removeAllObjects];
+}
+
+- (void)_startPendingRequestsIfNeeded
+{
+    const NSUInteger maximumActiveRequests = MAX(_resourcePolicy.limits.backgroundConcurrency, (NSUInteger)1);
+    NSUInteger numberOfActiveRequests = self.numberOfActiveRequests;
+
+    while (numberOfActiveRequests < maximumActiveRequests) {
+        // Find the pending request closest to the current page
+        TOPagingViewPageLoaderRequest *nextRequest = nil;
+        NSUInteger nextDistance = NSUIntegerMax;
+        for (TOPagingViewPageLoaderRequest *request in _requests.allValues) {
+            if (request.task != nil || request.isReadingFromCache) { continue; }
+            const NSUInteger distance = request.distance;
+            if (nextRequest != nil && distance >= nextDistance) { continue; }
+            nextRequest = request;
+            nextDistance = distance;
+        }
+        if (nextRequest == nil) { return; }
+
+        [self _startRequest:nextRequest];
+        numberOfActiveRequests++;
+    }
+}
+
+- (void)_startRequest:(TOPagingViewPageLoaderRequest *)request
+{
+    __weak typeof(self) weakSelf = self;
+    __weak TOPagingViewPageLoaderRequest *weakRequest = request;
+    request.task = [_session dataTaskWithURL:request.url completionHandler:^(NSData *data, NSURLResponse *response, NSError *error) {
+        [weakSelf _request:weakRequest didCompleteWithData:data response:response error:error];
+    }];
+    request.task.priority = TOPagingViewPageLoaderTaskPriorityForDistance(request.distance);
+    [request.task resume];
+}
+
+- (void)_request:(nullable TOPagingViewPageLoaderRequest *)request
+    didCompleteWithData:(nullable NSData *)data
+               response:(nullable NSURLResponse *)response
+                  error:(nullable NSError *)error
+{
+    // Skip requests that were cancelled in the meantime
+    if (request == nil || _requests[request.url] != request) { return; }
+    [_requests removeObjectForKey:request.url];
+
+    // Treat HTTP error statuses as failures so callers don't try to display an error page
+    if (error == nil && [response isKindOfClass:[NSHTTPURLResponse class]]) {
+        const NSInteger statusCode = ((NSHTTPURLResponse *)response).statusCode;
+        if (statusCode < 200 || statusCode >= 300) {
+            error = [NSError errorWithDomain:NSURLErrorDomain
+                                        code:NSURLErrorBadServerResponse
+                                    userInfo:@{NSURLErrorFailingURLErrorKey: request.url}];
+            data = nil;
+        }
+    }
+
+    // Keep a copy of anything successfully downloaded
+    if (data && error == nil && response != nil && request.cacheKey) {
+        [_diskCache setData:data forKey:request.cacheKey];
+    }
+
+    // Start the next request before calling back, in case a caller asks for more pages
+    [self _startPendingRequestsIfNeeded];
+
+    for (TOPagingViewPageLoaderSubscriber *subscriber in request.subscribers) {
+        if (subscriber.owner == nil) { continue; }
+        subscriber.completionHandler(data, error);
+    }
+}
+
+#pragma mark - Accessors -
+
+- (void)setResourcePolicy:(id<TOPagingViewResourcePolicy>)resourcePolicy
+{
+    if (resourcePolicy == nil) { resourcePolicy = TOPagingViewDefaultResourcePolicy.sharedPolicy; }
+    if (resourcePolicy == _resourcePolicy) { return; }
+
+    NSNotificationCenter *const notificationCenter = [NSNotificationCenter defaultCenter];
+    if (_resourcePolicy) {
+        [notificationCenter removeObserver:self name:TOPagingViewResourcePolicyDidChangeNotification object:_resourcePolicy];
+    }
+    _resourcePolicy = resourcePolicy;
+    [notificationCenter addObserver:self
+                           selector:@selector(_resourcePolicyDidChange:)
+                               name:TOPagingViewResourcePolicyDidChangeNotification
+                             object:resourcePolicy];
+    [self _startPendingRequestsIfNeeded];
+}
+
+- (void)_resourcePolicyDidChange:(NSNotification *)notification
+{
+    // Lowering the limit lets running requests finish, but raising it can start more straight away
+    [self _startPendingRequestsIfNeeded];
+}
+
+- (NSUInteger)numberOfActiveRequests
+{
+    NSUInteger count = 0;
+    for (TOPagingViewPageLoaderRequest *request in _requests.allValues) {
+        if (request.task != nil) { count++; }
+    }
+    return count;
+}
+
+- (NSUInteger)numberOfPendingRequests
+{
+    NSUInteger count = 0;
+    for (TOPagingViewPageLoaderRequest *request in _requests.allValues) {
+        if (request.task == nil && !request.isReadingFromCache) { count++; }
+    }
+    return count;
+}
+
+@end
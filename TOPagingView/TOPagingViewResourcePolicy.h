@@ -0,0 +1,91 @@
+//
+//  TOPagingViewResourcePolicy.h
+//
+//  Copyright 2023 Timothy Oliver. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to
+//  deal in the Software without restriction, including without limitation the
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+//  sell copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//  WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+//  IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Posted by a resource policy whenever its limits change. The object is the policy.
+FOUNDATION_EXTERN NSNotificationName const TOPagingViewResourcePolicyDidChangeNotification NS_SWIFT_NAME(PagingViewResourcePolicy.didChangeNotification);
+
+/// The limits a resource policy places on the work and memory used by paging views and their supporting components.
+typedef struct TOPagingViewResourceLimits {
+    /// Whether the adjacent pages may be laid out and displayed ahead of time. Paging views only hold one page
+    /// either side of the current page, so this acts as an on/off switch, with any value above 0 preparing both.
+    /// At 0, adjacent pages are still fetched so they can be swiped to, but they won't be prepared until needed.
+    NSUInteger prefetchRadius;
+
+    /// The most recycled pages that may be kept in the pool for each page identifier. Pages beyond this are released,
+    /// and the pools are trimmed straight away when the limit is lowered.
+    NSUInteger pagePoolCapacity;
+
+    /// The most memory, in bytes, that may be used to cache page snapshots.
+    NSUInteger snapshotCacheByteLimit;
+
+    /// The most background operations (eg, network requests or disk access) that may run at once.
+    NSUInteger backgroundConcurrency;
+} TOPagingViewResourceLimits NS_SWIFT_NAME(PagingViewResourceLimits);
+
+/// An object that decides how much work and memory paging views may use, and which may change over time.
+NS_SWIFT_NAME(PagingViewResourcePolicy)
+@protocol TOPagingViewResourcePolicy <NSObject>
+
+/// The current limits. Post `TOPagingViewResourcePolicyDidChangeNotification` when these change.
+@property (nonatomic, readonly) TOPagingViewResourceLimits limits;
+
+@end
+
+// -------------------------------------------------------------------
+
+/// The policy used by default, which backs off as the device heats up or when Low Power Mode is enabled.
+NS_SWIFT_NAME(PagingViewDefaultResourcePolicy)
+@interface TOPagingViewDefaultResourcePolicy : NSObject <TOPagingViewResourcePolicy>
+
+/// A shared instance of the policy, observing the current state of the device.
+@property (class, nonatomic, readonly) TOPagingViewDefaultResourcePolicy *sharedPolicy;
+
+/// The limits this policy applies for a given device state.
+/// - Parameters:
+///   - thermalState: The thermal state of the device.
+///   - isLowPowerModeEnabled: Whether the device is in Low Power Mode.
++ (TOPagingViewResourceLimits)limitsForThermalState:(NSProcessInfoThermalState)thermalState
+                              isLowPowerModeEnabled:(BOOL)isLowPowerModeEnabled;
+
+@end
+
+// -------------------------------------------------------------------
+
+/// A policy whose limits are set directly, for when they need to be controlled explicitly, such as in tests.
+NS_SWIFT_NAME(PagingViewFixedResourcePolicy)
+@interface TOPagingViewFixedResourcePolicy : NSObject <TOPagingViewResourcePolicy>
+
+/// The limits of this policy. Setting this posts `TOPagingViewResourcePolicyDidChangeNotification` on the calling thread.
+@property (nonatomic, assign) TOPagingViewResourceLimits limits;
+
+/// Creates a new policy with the given limits.
+/// - Parameter limits: The limits the policy starts with.
+- (instancetype)initWithLimits:(TOPagingViewResourceLimits)limits;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,157 @@
+//
+//  TOPagingViewResourcePolicy.m
+//
+//  Copyright 2023 Timothy Oliver. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to
+//  deal in the Software without restriction, including without limitation the
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+//  sell copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//  WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+//  IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#import "TOPagingViewResourcePolicy.h"
+
+NSNotificationName const TOPagingViewResourcePolicyDidChangeNotification = @"TOPagingViewResourcePolicyDidChangeNotification";
+
+/// The limits when the device is under no pressure at all.
+static const TOPagingViewResourceLimits kTOPagingViewNominalResourceLimits = {
+    .prefetchRadius = 1,
+    .pagePoolCapacity = 4,
+    .snapshotCacheByteLimit = 64 * 1024 * 1024,
+    .backgroundConcurrency = 4
+};
+
+// -----------------------------------------------------------------
+
+@implementation TOPagingViewDefaultResourcePolicy {
+    TOPagingViewResourceLimits _limits;
+}
+
++ (TOPagingViewDefaultResourcePolicy *)sharedPolicy
+{
+    static TOPagingViewDefaultResourcePolicy *sharedPolicy = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedPolicy = [[TOPagingViewDefaultResourcePolicy alloc] init];
+    });
+    return sharedPolicy;
+}
+
++ (TOPagingViewResourceLimits)limitsForThermalState:(NSProcessInfoThermalState)thermalState
+                              isLowPowerModeEnabled:(BOOL)isLowPowerModeEnabled
+{
+    TOPagingViewResourceLimits limits = kTOPagingViewNominalResourceLimits;
+
+    switch (thermalState) {
+        case NSProcessInfoThermalStateNominal:
+            break;
+        case NSProcessInfoThermalStateFair:
+            limits.backgroundConcurrency = 2;
+            break;
+        case NSProcessInfoThermalStateSerious:
+            limits.prefetchRadius = 0;
+            limits.pagePoolCapacity = 2;
+            limits.snapshotCacheByteLimit = 16 * 1024 * 1024;
+            limits.backgroundConcurrency = 1;
+            break;
+        case NSProcessInfoThermalStateCritical:
+            limits.prefetchRadius = 0;
+            limits.pagePoolCapacity = 1;
+            limits.snapshotCacheByteLimit = 0;
+            limits.backgroundConcurrency = 1;
+            break;
+    }
+
+    // Low Power Mode saves work, but since memory isn't the concern, the caches may stay as they are
+    if (isLowPowerModeEnabled) {
+        limits.prefetchRadius = 0;
+        limits.backgroundConcurrency = MIN(limits.backgroundConcurrency, (NSUInteger)1);
+    }
+
+    return limits;
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        [self _updateLimits];
+
+        NSNotificationCenter *const notificationCenter = [NSNotificationCenter defaultCenter];
+        [notificationCenter addObserver:self
+                               selector:@selector(_processInfoStateDidChange:)
+                                   name:NSProcessInfoThermalStateDidChangeNotification
+                                 object:nil];
+        [notificationCenter addObserver:self
+                               selector:@selector(_processInfoStateDidChange:)
+                                   name:NSProcessInfoPowerStateDidChangeNotification
+                                 object:nil];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+- (void)_processInfoStateDidChange:(NSNotification *)notification
+{
+    // These may be posted on any thread, but paging views must only react on the main thread
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [self _updateLimits];
+    });
+}
+
+- (void)_updateLimits
+{
+    NSProcessInfo *const processInfo = [NSProcessInfo processInfo];
+    const TOPagingViewResourceLimits limits = [TOPagingViewDefaultResourcePolicy limitsForThermalState:processInfo.thermalState
+                                                                                 isLowPowerModeEnabled:processInfo.isLowPowerModeEnabled];
+    if (memcmp(&limits, &_limits, sizeof(TOPagingViewResourceLimits)) == 0) { return; }
+    _limits = limits;
+    [[NSNotificationCenter defaultCenter] postNotificationName:TOPagingViewResourcePolicyDidChangeNotification object:self];
+}
+
+- (TOPagingViewResourceLimits)limits
+{
+    return _limits;
+}
+
+@end
+
+// -----------------------------------------------------------------
+
+@implementation TOPagingViewFixedResourcePolicy
+
+- (instancetype)init
+{
+    return [self initWithLimits:kTOPagingViewNominalResourceLimits];
+}
+
+- (instancetype)initWithLimits:(TOPagingViewResourceLimits)limits
+{
+    self = [super init];
+    if (self) { _limits = limits; }
+    return self;
+}
+
+- (void)setLimits:(TOPagingViewResourceLimits)limits
+{
+    _limits = limits;
+    [[NSNotificationCenter defaultCenter] postNotificationName:TOPagingViewResourcePolicyDidChangeNotification object:self];
+}
+
+@end
@@ -0,0 +1,85 @@
+//
+//  TOPagingViewSnapshotStore.h
+//
+//  Copyright 2023 Timothy Oliver. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to
+//  deal in the Software without restriction, including without limitation the
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+//  sell copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//  WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+//  IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#import <UIKit/UIKit.h>
+#import "TOPagingViewDiskCache.h"
+#import "TOPagingViewResourcePolicy.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A store of compressed snapshots of pages, persisted on disk across launches, that paging views
+/// can show in place of a page while it is still being configured.
+///
+/// Snapshots are keyed by the page's `uniqueIdentifier` and size, so a page is never shown with a snapshot
+/// taken at a different size. Recently used snapshots are also kept decoded in memory, so they can be shown
+/// without waiting. Disk access, compression and decompression all happen off the main thread.
+NS_SWIFT_NAME(PagingViewSnapshotStore)
+@interface TOPagingViewSnapshotStore : NSObject
+
+/// The disk cache the compressed snapshots are persisted in. Its byte limit controls how many are kept on disk.
+@property (nonatomic, readonly) TOPagingViewDiskCache *diskCache;
+
+/// The policy deciding how much memory decoded snapshots may use. Defaults to the shared `TOPagingViewDefaultResourcePolicy`.
+@property (nonatomic, strong, null_resettable) id<TOPagingViewResourcePolicy> resourcePolicy;
+
+/// Creates a new store persisting its snapshots in the given disk cache.
+/// - Parameter diskCache: The disk cache to persist the snapshots in. It shouldn't be used for anything else.
+- (instancetype)initWithDiskCache:(TOPagingViewDiskCache *)diskCache NS_DESIGNATED_INITIALIZER;
+
+/// Creates a new store in the app's caches directory, limited to 50MB on disk.
+- (instancetype)init;
+
+/// Returns a snapshot if it is already decoded in memory, without touching the disk.
+/// - Parameters:
+///   - uniqueIdentifier: The unique identifier of the page.
+///   - size: The size of the page, in points.
+- (nullable UIImage *)snapshotForUniqueIdentifier:(NSString *)uniqueIdentifier size:(CGSize)size;
+
+/// Returns whether a snapshot exists, either in memory or on disk. This is cheap, and never touches the disk.
+/// - Parameters:
+///   - uniqueIdentifier: The unique identifier of the page.
+///   - size: The size of the page, in points.
+- (BOOL)containsSnapshotForUniqueIdentifier:(NSString *)uniqueIdentifier size:(CGSize)size;
+
+/// Loads and decodes a snapshot from disk in the background, keeping it in memory afterwards.
+/// - Parameters:
+///   - uniqueIdentifier: The unique identifier of the page.
+///   - size: The size of the page, in points.
+///   - completionHandler: Called on the main queue with the snapshot, or nil if there isn't one.
+- (void)loadSnapshotForUniqueIdentifier:(NSString *)uniqueIdentifier
+                                   size:(CGSize)size
+                      completionHandler:(void (^)(UIImage *_Nullable snapshot))completionHandler;
+
+/// Renders a snapshot of a view at its current size, and then compresses and persists it in the background.
+/// This must be called on the main thread, and is best done when the user isn't interacting.
+/// - Parameters:
+///   - view: The view to snapshot, usually a page view whose content has fully loaded.
+///   - uniqueIdentifier: The unique identifier of the page.
+- (void)storeSnapshotOfView:(UIView *)view forUniqueIdentifier:(NSString *)uniqueIdentifier;
+
+/// Removes every snapshot, both in memory and on disk.
+- (void)removeAllSnapshots;
+
+@end
+
+NS_ASSUME_NONNULL_END
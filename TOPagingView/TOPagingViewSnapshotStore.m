@@ -0,0 +1,202 @@
+//
+//  TOPagingViewSnapshotStore.m
+//
+//  Copyright 2023 Timothy Oliver. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to
+//  deal in the Software without restriction, including without limitation the
+//  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+//  sell copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//  WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+//  IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#import "TOPagingViewSnapshotStore.h"
+
+/// The disk limit used by the default store.
+static const NSUInteger kTOPagingViewSnapshotStoreDefaultByteLimit = 50 * 1024 * 1024;
+
+/// The quality snapshots are compressed at. Snapshots are only shown briefly, so this favours size.
+static const CGFloat kTOPagingViewSnapshotStoreCompressionQuality = 0.7f;
+
+// -----------------------------------------------------------------
+
+static UIImage *TOPagingViewSnapshotStoreDecodedImage(NSData *data, CGFloat scale)
+{
+    UIImage *const image = [UIImage imageWithData:data scale:scale];
+    if (image == nil) { return nil; }
+
+    // Drawing the image forces it to be decompressed now, instead of lazily on the main thread
+    UIGraphicsImageRendererFormat *const format = [UIGraphicsImageRendererFormat preferredFormat];
+    format.scale = scale;
+    format.opaque = YES;
+    UIGraphicsImageRenderer *const renderer = [[UIGraphicsImageRenderer alloc] initWithSize:image.size format:format];
+    return [renderer imageWithActions:^(UIGraphicsImageRendererContext *context) {
+        [image drawAtPoint:CGPointZero];
+    }];
+}
+
+// -----------------------------------------------------------------
+
+@implementation TOPagingViewSnapshotStore {
+    /// Recently used snapshots, already decoded so they can be displayed straight away.
+    NSCache<NSString *, UIImage *> *_memoryCache;
+
+    /// The queue snapshots are compressed and decompressed on.
+    dispatch_queue_t _codingQueue;
+
+    /// The scale snapshots are rendered at, captured up front since `UIScreen` is only safe to use on the main thread.
+    CGFloat _scale;
+}
+
+- (instancetype)init
+{
+    NSURL *const cachesURL = [[NSFileManager defaultManager] URLsForDirectory:NSCachesDirectory inDomains:NSUserDomainMask].firstObject;
+    NSURL *const directoryURL = [cachesURL URLByAppendingPathComponent:@"TOPagingViewSnapshotStore" isDirectory:YES];
+    return [self initWithDiskCache:[[TOPagingViewDiskCache alloc] initWithDirectoryURL:directoryURL
+                                                                             byteLimit:kTOPagingViewSnapshotStoreDefaultByteLimit]];
+}
+
+- (instancetype)initWithDiskCache:(TOPagingViewDiskCache *)diskCache
+{
+    self = [super init];
+    if (self) {
+        _diskCache = diskCache;
+        _memoryCache = [[NSCache alloc] init];
+        _codingQueue = dispatch_queue_create("dev.tim.TOPagingViewSnapshotStore", DISPATCH_QUEUE_SERIAL);
+        _scale = [UIScreen mainScreen].scale;
+        [self setResourcePolicy:nil];
+    }
+    return self;
+}
+
+#pragma mark - Public Interface -
+
+- (nullable UIImage *)snapshotForUniqueIdentifier:(NSString *)uniqueIdentifier size:(CGSize)size
+{
+    return [_memoryCache objectForKey:[self _keyForUniqueIdentifier:uniqueIdentifier size:size]];
+}
+
+- (BOOL)containsSnapshotForUniqueIdentifier:(NSString *)uniqueIdentifier size:(CGSize)size
+{
+    NSString *const key = [self _keyForUniqueIdentifier:uniqueIdentifier size:size];
+    return [_memoryCache objectForKey:key] != nil || [_diskCache containsDataForKey:key];
+}
+
+- (void)loadSnapshotForUniqueIdentifier:(NSString *)uniqueIdentifier
+                                   size:(CGSize)size
+                      completionHandler:(void (^)(UIImage *_Nullable))completionHandler
+{
+    NSString *const key = [self _keyForUniqueIdentifier:uniqueIdentifier size:size];
+    UIImage *const cachedSnapshot = [_memoryCache objectForKey:key];
+    if (cachedSnapshot) {
+        completionHandler(cachedSnapshot);
+        return;
+    }
+
+    const CGFloat scale = _scale;
+    [_diskCache dataForKey:key completionHandler:^(NSData *data) {
+        if (data == nil) {
+            completionHandler(nil);
+            return;
+        }
+
+        // Decode the image in the background, so it doesn't have to be done on the main thread when first drawn
+        dispatch_async(self->_codingQueue, ^{
+            UIImage *const snapshot = TOPagingViewSnapshotStoreDecodedImage(data, scale);
+            dispatch_async(dispatch_get_main_queue(), ^{
+                if (snapshot) { [self _cacheSnapshot:snapshot forKey:key]; }
+                completionHandler(snapshot);
+            });
+        });
+    }];
+}
+
+- (void)storeSnapshotOfView:(UIView *)view forUniqueIdentifier:(NSString *)uniqueIdentifier
+{
+    const CGRect bounds = view.bounds;
+    if (CGRectIsEmpty(bounds)) { return; }
+
+    UIGraphicsImageRendererFormat *const format = [UIGraphicsImageRendererFormat preferredFormat];
+    format.scale = _scale;
+    format.opaque = view.isOpaque;
+    UIGraphicsImageRenderer *const renderer = [[UIGraphicsImageRenderer alloc] initWithBounds:bounds format:format];
+    UIImage *const snapshot = [renderer imageWithActions:^(UIGraphicsImageRendererContext *context) {
+        // Views outside of a window can only be captured through their layer
+        if (view.window) { [view drawViewHierarchyInRect:bounds afterScreenUpdates:NO]; }
+        else { [view.layer renderInContext:context.CGContext]; }
+    }];
+
+    NSString *const key = [self _keyForUniqueIdentifier:uniqueIdentifier size:bounds.size];
+    [self _cacheSnapshot:snapshot forKey:key];
+
+    // Compress and persist it in the background
+    TOPagingViewDiskCache *const diskCache = _diskCache;
+    dispatch_async(_codingQueue, ^{
+        NSData *const data = UIImageJPEGRepresentation(snapshot, kTOPagingViewSnapshotStoreCompressionQuality);
+        if (data) { [diskCache setData:data forKey:key]; }
+    });
+}
+
+- (void)removeAllSnapshots
+{
+    [_memoryCache removeAllObjects];
+    [_diskCache removeAllData];
+}
+
+#pragma mark - Caching -
+
+- (NSString *)_keyForUniqueIdentifier:(NSString *)uniqueIdentifier size:(CGSize)size
+{
+    return [NSString stringWithFormat:@"%@|%.0fx%.0f@%.0f", uniqueIdentifier, size.width, size.height, _scale];
+}
+
+- (void)_cacheSnapshot:(UIImage *)snapshot forKey:(NSString *)key
+{
+    if (_resourcePolicy.limits.snapshotCacheByteLimit == 0) { return; }
+
+    // Cost the snapshot by the memory its decoded bitmap takes up
+    const CGSize size = snapshot.size;
+    const CGFloat scale = snapshot.scale;
+    const NSUInteger cost = (NSUInteger)(size.width * scale * size.height * scale * 4.0f);
+    [_memoryCache setObject:snapshot forKey:key cost:cost];
+}
+
+#pragma mark - Accessors -
+
+- (void)setResourcePolicy:(id<TOPagingViewResourcePolicy>)resourcePolicy
+{
+    if (resourcePolicy == nil) { resourcePolicy = TOPagingViewDefaultResourcePolicy.sharedPolicy; }
+    if (resourcePolicy == _resourcePolicy) { return; }
+
+    NSNotificationCenter *const notificationCenter = [NSNotificationCenter defaultCenter];
+    if (_resourcePolicy) {
+        [notificationCenter removeObserver:self name:TOPagingViewResourcePolicyDidChangeNotification object:_resourcePolicy];
+    }
+    _resourcePolicy = resourcePolicy;
+    [notificationCenter addObserver:self
+                           selector:@selector(_resourcePolicyDidChange:)
+                               name:TOPagingViewResourcePolicyDidChangeNotification
+                             object:resourcePolicy];
+    [self _resourcePolicyDidChange:nil];
+}
+
+- (void)_resourcePolicyDidChange:(nullable NSNotification *)notification
+{
+    // A limit of 0 would make the cache unbounded, so disable it entirely instead
+    const NSUInteger byteLimit = _resourcePolicy.limits.snapshotCacheByteLimit;
+    _memoryCache.totalCostLimit = MAX(byteLimit, (NSUInteger)1);
+    if (byteLimit == 0) { [_memoryCache removeAllObjects]; }
+}
+
+@end
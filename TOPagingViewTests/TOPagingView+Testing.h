@@ -0,0 +1,25 @@
+//
+//  TOPagingView+Testing.h
+//  TOPagingViewTests
+//
+//  Copyright © 2023 Tim Oliver. All rights reserved.
+//
+
+#import "TOPagingView.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Private state of the paging view that the tests need to inspect.
+/// These are all backed by properties declared in the class extension of TOPagingView.m.
+@interface TOPagingView (Testing)
+
+/// The pool of recycled pages, keyed by each page class's identifier.
+@property (nonatomic, readonly) NSMutableDictionary<NSString *, NSMutableSet *> *queuedPages;
+
+/// Whether the adjacent pages are waiting to be laid out and displayed at the next idle point.
+@property (nonatomic, readonly) BOOL needsNextPagePrewarm;
+@property (nonatomic, readonly) BOOL needsPreviousPagePrewarm;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,85 @@
+//
+//  TOPagingViewBackgroundReleaseTests.m
+//  TOPagingViewTests
+//
+//  Copyright © 2023 Tim Oliver. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "TOPagingView.h"
+#import "TOPagingView+Testing.h"
+#import "TOPagingViewTestDocument.h"
+
+@interface TOPagingViewBackgroundReleaseTests : XCTestCase
+@property (nonatomic, strong) UIView *containerView;
+@property (nonatomic, strong) TOPagingViewTestDocument *document;
+@property (nonatomic, strong) TOPagingView *pagingView;
+@end
+
+@implementation TOPagingViewBackgroundReleaseTests
+
+- (void)setUp
+{
+    _containerView = [[UIView alloc] initWithFrame:(CGRect){0, 0, 320, 480}];
+
+    _document = [TOPagingViewTestDocument new];
+    _document.pageIndex = 5;
+    _document.lastPageIndex = 10;
+
+    _pagingView = [[TOPagingView alloc] initWithFrame:_containerView.bounds];
+    [_pagingView registerPageViewClass:TOPagingViewTestPageView.class];
+    _pagingView.dataSource = _document;
+    _pagingView.delegate = _document;
+    [_containerView addSubview:_pagingView];
+    [_pagingView layoutIfNeeded];
+}
+
+- (NSUInteger)pooledPageCount
+{
+    NSUInteger count = 0;
+    for (NSMutableSet *pool in _pagingView.queuedPages.allValues) { count += pool.count; }
+    return count;
+}
+
+- (void)postNotificationName:(NSNotificationName)name
+{
+    [[NSNotificationCenter defaultCenter] postNotificationName:name object:[UIApplication sharedApplication]];
+}
+
+- (void)testPagesAreKeptInBackgroundByDefault
+{
+    XCTAssertFalse(_pagingView.isBackgroundPageReleasingEnabled);
+
+    [self postNotificationName:UIApplicationDidEnterBackgroundNotification];
+    XCTAssertEqual(((TOPagingViewTestPageView *)_pagingView.nextPageView).number, 6);
+    XCTAssertEqual(((TOPagingViewTestPageView *)_pagingView.previousPageView).number, 4);
+    [self postNotificationName:UIApplicationWillEnterForegroundNotification];
+}
+
+- (void)testAdjacentPagesAreReleasedInBackgroundAndRestoredInForeground
+{
+    _pagingView.isBackgroundPageReleasingEnabled = YES;
+
+    // Only the current page is kept, and the released pages aren't held onto anywhere else
+    __weak UIView *weakNextPageView = nil;
+    @autoreleasepool {
+        weakNextPageView = _pagingView.nextPageView;
+        XCTAssertEqual(_pagingView.orderedVisiblePageViews.count, 3);
+        [self postNotificationName:UIApplicationDidEnterBackgroundNotification];
+    }
+    XCTAssertNil(_pagingView.nextPageView);
+    XCTAssertNil(_pagingView.previousPageView);
+    XCTAssertEqual(((TOPagingViewTestPageView *)_pagingView.currentPageView).number, 5);
+    XCTAssertEqual([self pooledPageCount], 0);
+    XCTAssertNil(weakNextPageView);
+
+    // Returning to the foreground requests the adjacent pages again, one per layout pass
+    [self postNotificationName:UIApplicationWillEnterForegroundNotification];
+    [_pagingView layoutIfNeeded];
+    [_pagingView layoutIfNeeded];
+    XCTAssertEqual(((TOPagingViewTestPageView *)_pagingView.nextPageView).number, 6);
+    XCTAssertEqual(((TOPagingViewTestPageView *)_pagingView.previousPageView).number, 4);
+    XCTAssertEqual(_pagingView.orderedVisiblePageViews.count, 3);
+}
+
+@end
@@ -0,0 +1,95 @@
+//
+//  TOPagingViewCoordinatorTests.m
+//  TOPagingViewTests
+//
+//  Copyright © 2023 Tim Oliver. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "TOPagingView.h"
+#import "TOPagingViewTestDocument.h"
+
+@interface TOPagingViewCoordinatorTests : XCTestCase
+@property (nonatomic, strong) UIView *containerView;
+@property (nonatomic, strong) TOPagingViewCoordinator *coordinator;
+@end
+
+@implementation TOPagingViewCoordinatorTests
+
+- (void)setUp
+{
+    _containerView = [[UIView alloc] initWithFrame:(CGRect){0, 0, 320, 480}];
+    _coordinator = [[TOPagingViewCoordinator alloc] init];
+}
+
+- (TOPagingView *)makePagingViewWithDocument:(TOPagingViewTestDocument *)document
+{
+    TOPagingView *pagingView = [[TOPagingView alloc] initWithFrame:_containerView.bounds];
+    [pagingView registerPageViewClass:TOPagingViewTestPageView.class];
+    pagingView.dataSource = document;
+    pagingView.delegate = document;
+    [_containerView addSubview:pagingView];
+    [pagingView layoutIfNeeded];
+    [_coordinator addPagingView:pagingView];
+    return pagingView;
+}
+
+- (void)testLinkedViewsTurnAndSkipTogether
+{
+    TOPagingViewTestDocument *firstDocument = [TOPagingViewTestDocument new];
+    TOPagingViewTestDocument *secondDocument = [TOPagingViewTestDocument new];
+    firstDocument.lastPageIndex = 10;
+    secondDocument.lastPageIndex = 10;
+    TOPagingView *firstPagingView = [self makePagingViewWithDocument:firstDocument];
+    TOPagingView *secondPagingView = [self makePagingViewWithDocument:secondDocument];
+
+    // Turning one view turns the other in the same direction
+    [firstPagingView turnToNextPageAnimated:NO];
+    [firstPagingView layoutIfNeeded];
+    [secondPagingView layoutIfNeeded];
+    XCTAssertEqual(firstDocument.pageIndex, 1);
+    XCTAssertEqual(secondDocument.pageIndex, 1);
+    XCTAssertEqual(((TOPagingViewTestPageView *)secondPagingView.currentPageView).number, 1);
+
+    [secondPagingView turnToPreviousPageAnimated:NO];
+    [firstPagingView layoutIfNeeded];
+    [secondPagingView layoutIfNeeded];
+    XCTAssertEqual(firstDocument.pageIndex, 0);
+    XCTAssertEqual(secondDocument.pageIndex, 0);
+
+    // Skipping one view mirrors the skip in the other, once both data sources have been updated
+    firstDocument.pageIndex = 7;
+    secondDocument.pageIndex = 7;
+    [firstPagingView skipForwardToNewPageAnimated:NO];
+    XCTAssertEqual(((TOPagingViewTestPageView *)firstPagingView.currentPageView).number, 7);
+    XCTAssertEqual(((TOPagingViewTestPageView *)secondPagingView.currentPageView).number, 7);
+    XCTAssertEqual(((TOPagingViewTestPageView *)secondPagingView.nextPageView).number, 8);
+    XCTAssertEqual(((TOPagingViewTestPageView *)secondPagingView.previousPageView).number, 6);
+}
+
+- (void)testSlotsAreReopenedWhenALinkedViewGainsAPage
+{
+    TOPagingViewTestDocument *firstDocument = [TOPagingViewTestDocument new];
+    TOPagingViewTestDocument *secondDocument = [TOPagingViewTestDocument new];
+    firstDocument.lastPageIndex = 10;
+    secondDocument.lastPageIndex = 1;
+    TOPagingView *firstPagingView = [self makePagingViewWithDocument:firstDocument];
+    TOPagingView *secondPagingView = [self makePagingViewWithDocument:secondDocument];
+
+    // Once the second view reaches its last page, neither view may scroll towards a next page
+    [firstPagingView turnToNextPageAnimated:NO];
+    [firstPagingView layoutIfNeeded];
+    [secondPagingView layoutIfNeeded];
+    XCTAssertNil(secondPagingView.nextPageView);
+    XCTAssertNotNil(firstPagingView.nextPageView);
+    XCTAssertLessThan(firstPagingView.scrollView.contentInset.right, 0.0f);
+
+    // When the second view gains a next page later, the first view's slot is opened again straight away
+    secondDocument.lastPageIndex = 10;
+    [secondPagingView fetchAdjacentPagesIfAvailable];
+    XCTAssertNotNil(secondPagingView.nextPageView);
+    XCTAssertGreaterThan(firstPagingView.scrollView.contentInset.right, 0.0f);
+    XCTAssertGreaterThan(secondPagingView.scrollView.contentInset.right, 0.0f);
+}
+
+@end
@@ -0,0 +1,94 @@
+//
+//  TOPagingViewDataSourceBudgetTests.m
+//  TOPagingViewTests
+//
+//  Copyright © 2023 Tim Oliver. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "TOPagingView.h"
+#import "TOPagingViewTestDocument.h"
+
+@interface TOPagingViewDataSourceBudgetTests : XCTestCase <UIScrollViewDelegate>
+@property (nonatomic, strong) UIWindow *window;
+@property (nonatomic, strong) TOPagingViewTestDocument *document;
+@property (nonatomic, strong) TOPagingView *pagingView;
+@property (nonatomic, strong) XCTestExpectation *animationExpectation;
+@end
+
+@implementation TOPagingViewDataSourceBudgetTests
+
+- (void)setUp
+{
+    _window = [[UIWindow alloc] initWithFrame:(CGRect){0, 0, 320, 480}];
+    _window.hidden = NO;
+
+    _document = [TOPagingViewTestDocument new];
+    _document.pageIndex = 5;
+    _document.lastPageIndex = 10;
+
+    _pagingView = [[TOPagingView alloc] initWithFrame:_window.bounds];
+    [_pagingView registerPageViewClass:TOPagingViewTestPageView.class];
+    _pagingView.dataSource = _document;
+    _pagingView.delegate = _document;
+    _pagingView.scrollView.delegate = self;
+    [_window addSubview:_pagingView];
+    [_pagingView layoutIfNeeded];
+    [_pagingView resetMetrics];
+}
+
+- (void)tearDown
+{
+    _window.hidden = YES;
+    _window = nil;
+}
+
+- (void)scrollViewDidEndScrollingAnimation:(UIScrollView *)scrollView
+{
+    [_animationExpectation fulfill];
+}
+
+- (void)skipToPageIndex:(NSInteger)pageIndex
+{
+    const BOOL isForward = (pageIndex > _document.pageIndex);
+    _document.pageIndex = pageIndex;
+    _animationExpectation = [self expectationWithDescription:@"Skip animation completed"];
+    if (isForward) { [_pagingView skipForwardToNewPageAnimated:YES]; }
+    else { [_pagingView skipBackwardToNewPageAnimated:YES]; }
+    [self waitForExpectationsWithTimeout:2.0 handler:nil];
+}
+
+- (void)testAnimatedSkipToLastPageStaysWithinBudget
+{
+    [self skipToPageIndex:10];
+
+    XCTAssertEqual(((TOPagingViewTestPageView *)_pagingView.currentPageView).number, 10);
+    XCTAssertEqual(((TOPagingViewTestPageView *)_pagingView.previousPageView).number, 9);
+    XCTAssertNil(_pagingView.nextPageView);
+    XCTAssertEqual(_pagingView.metrics.dataSourceRequestCount, 3);
+    XCTAssertEqual(_pagingView.metrics.dataSourceBudgetOverrunCount, 0);
+}
+
+- (void)testAnimatedSkipToFirstPageStaysWithinBudget
+{
+    [self skipToPageIndex:0];
+
+    XCTAssertEqual(((TOPagingViewTestPageView *)_pagingView.currentPageView).number, 0);
+    XCTAssertEqual(((TOPagingViewTestPageView *)_pagingView.nextPageView).number, 1);
+    XCTAssertNil(_pagingView.previousPageView);
+    XCTAssertEqual(_pagingView.metrics.dataSourceRequestCount, 3);
+    XCTAssertEqual(_pagingView.metrics.dataSourceBudgetOverrunCount, 0);
+}
+
+- (void)testMissingPageIsCheckedAgainWhenRequested
+{
+    [self skipToPageIndex:10];
+
+    // A new explicit check is its own transition, so the data source is asked again
+    _document.lastPageIndex = 11;
+    [_pagingView fetchAdjacentPagesIfAvailable];
+    XCTAssertEqual(((TOPagingViewTestPageView *)_pagingView.nextPageView).number, 11);
+    XCTAssertEqual(_pagingView.metrics.dataSourceBudgetOverrunCount, 0);
+}
+
+@end
@@ -0,0 +1,207 @@
+//
+//  TOPagingViewDiskCacheTests.m
+//  TOPagingViewTests
+//
+//  Copyright © 2023 Tim Oliver. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <CommonCrypto/CommonDigest.h>
+#import "TOPagingViewDiskCache.h"
+
+/// Mirrors the cache's own hashing, so tests can find an entry's file and journal records.
+static NSString *TODiskCacheTestFileNameForKey(NSString *key)
+{
+    const char *const string = key.UTF8String;
+    unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256(string, (CC_LONG)strlen(string), digest);
+
+    NSMutableString *const fileName = [NSMutableString stringWithCapacity:CC_SHA256_DIGEST_LENGTH * 2];
+    for (NSUInteger i = 0; i < CC_SHA256_DIGEST_LENGTH; i++) {
+        [fileName appendFormat:@"%02x", digest[i]];
+    }
+    return fileName;
+}
+
+/// Ten bytes of data, so byte limits can be expressed as a number of entries.
+static NSData *TODiskCacheTestData(void)
+{
+    return [NSMutableData dataWithLength:10];
+}
+
+// -----------------------------------------------------------------
+
+@interface TOPagingViewDiskCacheTests : XCTestCase
+@property (nonatomic, strong) NSURL *directoryURL;
+@end
+
+@implementation TOPagingViewDiskCacheTests
+
+- (void)setUp
+{
+    [super setUp];
+    NSString *const directoryName = [NSString stringWithFormat:@"TOPagingViewDiskCacheTests-%@", [NSUUID UUID].UUIDString];
+    self.directoryURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:directoryName]
+                                   isDirectory:YES];
+}
+
+- (void)tearDown
+{
+    [[NSFileManager defaultManager] removeItemAtURL:self.directoryURL error:nil];
+    [super tearDown];
+}
+
+#pragma mark - Helpers -
+
+- (TOPagingViewDiskCache *)makeCacheWithByteLimit:(NSUInteger)byteLimit
+{
+    return [[TOPagingViewDiskCache alloc] initWithDirectoryURL:self.directoryURL byteLimit:byteLimit];
+}
+
+/// The cache does all of its work on a serial queue, so once a read has called back, everything before it has finished.
+- (void)waitForCache:(TOPagingViewDiskCache *)cache
+{
+    XCTestExpectation *const expectation = [self expectationWithDescription:@"Cache queue drained"];
+    [cache dataForKey:@"barrier" completionHandler:^(NSData *data) { [expectation fulfill]; }];
+    [self waitForExpectations:@[expectation] timeout:5.0];
+}
+
+- (NSURL *)journalURL
+{
+    return [self.directoryURL URLByAppendingPathComponent:@"journal" isDirectory:NO];
+}
+
+- (BOOL)fileExistsForKey:(NSString *)key
+{
+    NSURL *const fileURL = [self.directoryURL URLByAppendingPathComponent:TODiskCacheTestFileNameForKey(key)];
+    return [[NSFileManager defaultManager] fileExistsAtPath:fileURL.path];
+}
+
+#pragma mark - Tests -
+
+- (void)testEntriesAreAvailableAsSoonAsCacheIsCreated
+{
+    TOPagingViewDiskCache *cache = [self makeCacheWithByteLimit:1000];
+    [cache setData:TODiskCacheTestData() forKey:@"1"];
+    [self waitForCache:cache];
+
+    // The journal is replayed during init, so there is no window where existing entries are missing
+    cache = [self makeCacheWithByteLimit:1000];
+    XCTAssertTrue([cache containsDataForKey:@"1"]);
+    XCTAssertEqual(cache.totalByteCount, 10);
+}
+
+- (void)testJournalReplayRestoresRecentOrder
+{
+    TOPagingViewDiskCache *cache = [self makeCacheWithByteLimit:1000];
+    [cache setData:TODiskCacheTestData() forKey:@"1"];
+    [cache setData:TODiskCacheTestData() forKey:@"2"];
+    [cache setData:TODiskCacheTestData() forKey:@"3"];
+
+    // Reading the oldest entry makes it the most recently used
+    XCTestExpectation *const expectation = [self expectationWithDescription:@"Read entry"];
+    [cache dataForKey:@"1" completionHandler:^(NSData *data) {
+        XCTAssertEqual(data.length, 10);
+        [expectation fulfill];
+    }];
+    [self waitForExpectations:@[expectation] timeout:5.0];
+
+    // Reopening with room for two entries evicts the least recently used one, as recorded by the journal
+    cache = [self makeCacheWithByteLimit:20];
+    XCTAssertTrue([cache containsDataForKey:@"1"]);
+    XCTAssertFalse([cache containsDataForKey:@"2"]);
+    XCTAssertTrue([cache containsDataForKey:@"3"]);
+    XCTAssertEqual(cache.totalByteCount, 20);
+    XCTAssertFalse([self fileExistsForKey:@"2"]);
+}
+
+- (void)testTruncatedFinalRecordIsIgnored
+{
+    TOPagingViewDiskCache *cache = [self makeCacheWithByteLimit:1000];
+    [cache setData:TODiskCacheTestData() forKey:@"1"];
+    [cache setData:TODiskCacheTestData() forKey:@"2"];
+    [self waitForCache:cache];
+
+    // Simulate a crash part way through recording a removal, leaving a line without a newline
+    NSString *const partialRecord = [NSString stringWithFormat:@"D %@", TODiskCacheTestFileNameForKey(@"1")];
+    NSFileHandle *const fileHandle = [NSFileHandle fileHandleForWritingToURL:self.journalURL error:nil];
+    [fileHandle seekToEndOfFile];
+    [fileHandle writeData:[partialRecord dataUsingEncoding:NSUTF8StringEncoding]];
+    [fileHandle closeFile];
+
+    cache = [self makeCacheWithByteLimit:1000];
+    XCTAssertTrue([cache containsDataForKey:@"1"]);
+    XCTAssertTrue([cache containsDataForKey:@"2"]);
+    XCTAssertEqual(cache.totalByteCount, 20);
+}
+
+- (void)testFilesAndRecordsWithoutCounterpartsAreCleanedUp
+{
+    TOPagingViewDiskCache *cache = [self makeCacheWithByteLimit:1000];
+    [cache setData:TODiskCacheTestData() forKey:@"1"];
+    [cache setData:TODiskCacheTestData() forKey:@"2"];
+    [self waitForCache:cache];
+
+    // A file the journal doesn't know about, and a journal entry whose file has gone
+    NSURL *const orphanURL = [self.directoryURL URLByAppendingPathComponent:@"orphan"];
+    [TODiskCacheTestData() writeToURL:orphanURL atomically:YES];
+    NSURL *const missingURL = [self.directoryURL URLByAppendingPathComponent:TODiskCacheTestFileNameForKey(@"2")];
+    [[NSFileManager defaultManager] removeItemAtURL:missingURL error:nil];
+
+    cache = [self makeCacheWithByteLimit:1000];
+    XCTAssertFalse([[NSFileManager defaultManager] fileExistsAtPath:orphanURL.path]);
+    XCTAssertTrue([[NSFileManager defaultManager] fileExistsAtPath:self.journalURL.path]);
+    XCTAssertTrue([cache containsDataForKey:@"1"]);
+    XCTAssertFalse([cache containsDataForKey:@"2"]);
+    XCTAssertEqual(cache.totalByteCount, 10);
+}
+
+- (void)testLeastRecentlyUsedEntriesAreEvictedOverByteLimit
+{
+    TOPagingViewDiskCache *const cache = [self makeCacheWithByteLimit:30];
+    [cache setData:TODiskCacheTestData() forKey:@"1"];
+    [cache setData:TODiskCacheTestData() forKey:@"2"];
+    [cache setData:TODiskCacheTestData() forKey:@"3"];
+    [cache dataForKey:@"1" completionHandler:^(NSData *data) {}];
+    [cache setData:TODiskCacheTestData() forKey:@"4"];
+    [self waitForCache:cache];
+
+    XCTAssertTrue([cache containsDataForKey:@"1"]);
+    XCTAssertFalse([cache containsDataForKey:@"2"]);
+    XCTAssertTrue([cache containsDataForKey:@"3"]);
+    XCTAssertTrue([cache containsDataForKey:@"4"]);
+    XCTAssertEqual(cache.totalByteCount, 30);
+    XCTAssertFalse([self fileExistsForKey:@"2"]);
+
+    // Lowering the limit evicts straight away, oldest first
+    cache.byteLimit = 10;
+    [self waitForCache:cache];
+    XCTAssertFalse([cache containsDataForKey:@"1"]);
+    XCTAssertFalse([cache containsDataForKey:@"3"]);
+    XCTAssertTrue([cache containsDataForKey:@"4"]);
+    XCTAssertEqual(cache.totalByteCount, 10);
+}
+
+- (void)testJournalIsCompactedAfterManyReads
+{
+    const NSUInteger readCount = 1100;
+    TOPagingViewDiskCache *cache = [self makeCacheWithByteLimit:1000];
+    [cache setData:TODiskCacheTestData() forKey:@"1"];
+    for (NSUInteger i = 0; i < readCount; i++) {
+        [cache dataForKey:@"1" completionHandler:^(NSData *data) {}];
+    }
+    [self waitForCache:cache];
+
+    // Every read appends a record, so without compaction the journal would hold one line per read
+    NSString *const journal = [NSString stringWithContentsOfURL:self.journalURL encoding:NSUTF8StringEncoding error:nil];
+    const NSUInteger lineCount = [journal componentsSeparatedByString:@"\n"].count - 1;
+    XCTAssertGreaterThan(lineCount, 0);
+    XCTAssertLessThan(lineCount, readCount / 2);
+
+    // The compacted journal still replays to the same entry
+    cache = [self makeCacheWithByteLimit:1000];
+    XCTAssertTrue([cache containsDataForKey:@"1"]);
+    XCTAssertEqual(cache.totalByteCount, 10);
+}
+
+@end
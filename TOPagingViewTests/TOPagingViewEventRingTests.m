@@ -0,0 +1,111 @@
+//
+//  TOPagingViewEventRingTests.m
+//  TOPagingViewTests
+//
+//  Copyright © 2023 Tim Oliver. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "TOPagingViewEventRing.h"
+
+static inline TOPagingViewEvent TOEventRingTestEvent(int32_t value)
+{
+    return (TOPagingViewEvent){.timestamp = (CFTimeInterval)value, .value = value, .type = TOPagingViewEventTypeSkip};
+}
+
+// -----------------------------------------------------------------
+
+@interface TOPagingViewEventRingTests : XCTestCase
+@end
+
+@implementation TOPagingViewEventRingTests
+
+- (void)testCapacityIsRoundedUpToPowerOfTwo
+{
+    XCTAssertEqual([[TOPagingViewEventRing alloc] initWithCapacity:5].capacity, 8);
+    XCTAssertEqual([[TOPagingViewEventRing alloc] initWithCapacity:8].capacity, 8);
+    XCTAssertEqual([[TOPagingViewEventRing alloc] initWithCapacity:0].capacity, 1);
+    XCTAssertEqual([[TOPagingViewEventRing alloc] init].capacity, 256);
+}
+
+- (void)testOverflowDropsNewEventsAndCountsThem
+{
+    TOPagingViewEventRing *ring = [[TOPagingViewEventRing alloc] initWithCapacity:4];
+    for (int32_t i = 0; i < 4; i++) {
+        XCTAssertTrue([ring publishEvent:TOEventRingTestEvent(i)]);
+    }
+
+    // Once full, new events are dropped rather than overwriting the undrained ones
+    XCTAssertFalse([ring publishEvent:TOEventRingTestEvent(4)]);
+    XCTAssertFalse([ring publishEvent:TOEventRingTestEvent(5)]);
+    XCTAssertEqual(ring.overflowCount, 2);
+
+    TOPagingViewEvent buffer[8];
+    XCTAssertEqual([ring drainEventsIntoBuffer:buffer maximumCount:8], 4);
+    for (int32_t i = 0; i < 4; i++) {
+        XCTAssertEqual(buffer[i].value, i);
+    }
+
+    // Draining frees the slots up again, but the dropped events stay counted
+    XCTAssertTrue([ring publishEvent:TOEventRingTestEvent(6)]);
+    XCTAssertEqual(ring.overflowCount, 2);
+}
+
+- (void)testPartialDrainsWrapAroundInOrder
+{
+    TOPagingViewEventRing *ring = [[TOPagingViewEventRing alloc] initWithCapacity:4];
+    TOPagingViewEvent buffer[2];
+    NSMutableArray<NSNumber *> *values = [NSMutableArray array];
+
+    // Publish and drain in small batches, so the indices wrap past the capacity several times
+    int32_t nextValue = 0;
+    for (NSUInteger round = 0; round < 10; round++) {
+        XCTAssertTrue([ring publishEvent:TOEventRingTestEvent(nextValue++)]);
+        XCTAssertTrue([ring publishEvent:TOEventRingTestEvent(nextValue++)]);
+        const NSUInteger count = [ring drainEventsIntoBuffer:buffer maximumCount:1];
+        for (NSUInteger i = 0; i < count; i++) { [values addObject:@(buffer[i].value)]; }
+        [ring drainEventsUsingBlock:^(TOPagingViewEvent event) {
+            [values addObject:@(event.value)];
+        }];
+    }
+
+    XCTAssertEqual(ring.overflowCount, 0);
+    XCTAssertEqual(values.count, (NSUInteger)nextValue);
+    for (NSUInteger i = 0; i < values.count; i++) {
+        XCTAssertEqual(values[i].intValue, (int)i);
+    }
+}
+
+- (void)testConcurrentConsumerReceivesEventsInOrder
+{
+    TOPagingViewEventRing *ring = [[TOPagingViewEventRing alloc] initWithCapacity:64];
+    const int32_t eventCount = 100000;
+    __block NSUInteger receivedCount = 0;
+    __block int32_t lastValue = -1;
+    __block BOOL isOrdered = YES;
+
+    // Drain on a background thread while publishing as fast as possible on this one.
+    // Every event must either be received, in order, or be counted as dropped.
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Consumer accounted for every event"];
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+        while (receivedCount + ring.overflowCount < (NSUInteger)eventCount) {
+            receivedCount += [ring drainEventsUsingBlock:^(TOPagingViewEvent event) {
+                if (event.value <= lastValue) { isOrdered = NO; }
+                lastValue = event.value;
+            }];
+        }
+        [expectation fulfill];
+    });
+
+    NSUInteger publishedCount = 0;
+    for (int32_t i = 0; i < eventCount; i++) {
+        if ([ring publishEvent:TOEventRingTestEvent(i)]) { publishedCount++; }
+    }
+
+    [self waitForExpectationsWithTimeout:10.0 handler:nil];
+    XCTAssertTrue(isOrdered);
+    XCTAssertEqual(receivedCount, publishedCount);
+    XCTAssertEqual(ring.overflowCount, (NSUInteger)eventCount - publishedCount);
+}
+
+@end
@@ -0,0 +1,143 @@
+//
+//  TOPagingViewLiveResizeTests.m
+//  TOPagingViewTests
+//
+//  Copyright © 2023 Tim Oliver. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "TOPagingView.h"
+
+/// A page that counts how many times it has been laid out at a new size.
+@interface TOLiveResizeTestPageView : UIView <TOPagingViewPage>
+@property (nonatomic, assign) NSInteger resizeCount;
+@end
+
+@implementation TOLiveResizeTestPageView
+
+- (void)setFrame:(CGRect)frame
+{
+    if (!CGSizeEqualToSize(frame.size, self.frame.size)) { _resizeCount++; }
+    [super setFrame:frame];
+}
+
+@end
+
+// -----------------------------------------------------------------
+
+/// A document with an endless run of pages.
+@interface TOLiveResizeTestDocument : NSObject <TOPagingViewDataSource>
+@end
+
+@implementation TOLiveResizeTestDocument
+
+- (UIView<TOPagingViewPage> *)pagingView:(TOPagingView *)pagingView
+                         pageViewForType:(TOPagingViewPageType)type
+                         currentPageView:(UIView<TOPagingViewPage> *)currentPageView
+{
+    return [pagingView dequeueReusablePageView];
+}
+
+@end
+
+// -----------------------------------------------------------------
+
+@interface TOPagingViewLiveResizeTests : XCTestCase
+@property (nonatomic, strong) UIWindow *window;
+@property (nonatomic, strong) TOLiveResizeTestDocument *document;
+@property (nonatomic, strong) TOPagingView *pagingView;
+@end
+
+@implementation TOPagingViewLiveResizeTests
+
+- (void)setUp
+{
+    _window = [[UIWindow alloc] initWithFrame:(CGRect){0, 0, 320, 480}];
+    _window.hidden = NO;
+
+    _document = [TOLiveResizeTestDocument new];
+    _pagingView = [[TOPagingView alloc] initWithFrame:_window.bounds];
+    [_pagingView registerPageViewClass:TOLiveResizeTestPageView.class];
+    _pagingView.isLiveResizeDeferralEnabled = YES;
+    _pagingView.dataSource = _document;
+    [_window addSubview:_pagingView];
+    [_pagingView layoutIfNeeded];
+
+    // The initial layout counts as a size change, so let it settle before the tests start resizing
+    [self waitForInterval:0.2];
+}
+
+- (void)tearDown
+{
+    _window.hidden = YES;
+    _window = nil;
+}
+
+- (void)waitForInterval:(NSTimeInterval)interval
+{
+    [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:interval]];
+}
+
+- (void)resizeToWidth:(CGFloat)width
+{
+    _pagingView.frame = (CGRect){0, 0, width, 480};
+    [_pagingView layoutIfNeeded];
+}
+
+- (void)testContinuousResizeIsLaidOutOnceAfterSettling
+{
+    TOLiveResizeTestPageView *const pageView = (TOLiveResizeTestPageView *)_pagingView.currentPageView;
+    pageView.resizeCount = 0;
+
+    // A lone size change is laid out straight away
+    [self resizeToWidth:310];
+    XCTAssertEqual(pageView.resizeCount, 1);
+
+    // Changes closer together than the settle interval keep deferring the layout, however long they carry on for
+    for (NSInteger i = 0; i < 6; i++) {
+        [self waitForInterval:0.05];
+        [self resizeToWidth:300 - (i * 10)];
+    }
+    XCTAssertEqual(pageView.resizeCount, 1);
+    XCTAssertTrue(_pagingView.scrollView.isHidden);
+
+    // Once the size stops changing, the pages are laid out a single time at the final size
+    [self waitForInterval:0.4];
+    XCTAssertEqual(pageView.resizeCount, 2);
+    XCTAssertEqual(pageView.frame.size.width, 250);
+    XCTAssertFalse(_pagingView.scrollView.isHidden);
+}
+
+- (void)testLayoutPassesWithoutResizingDoNotHoldOffSettling
+{
+    TOLiveResizeTestPageView *const pageView = (TOLiveResizeTestPageView *)_pagingView.currentPageView;
+    [self resizeToWidth:310];
+    [self resizeToWidth:300];
+    XCTAssertTrue(_pagingView.scrollView.isHidden);
+
+    // Keep laying out at the same size for well past the settle interval, as other layout traffic would
+    for (NSInteger i = 0; i < 8; i++) {
+        [self waitForInterval:0.05];
+        [_pagingView setNeedsLayout];
+        [_pagingView layoutIfNeeded];
+    }
+
+    // Only actual size changes extend the live resize, so it has still settled on time
+    XCTAssertFalse(_pagingView.scrollView.isHidden);
+    XCTAssertEqual(pageView.frame.size.width, 300);
+}
+
+- (void)testTurningPageEndsLiveResize
+{
+    [self resizeToWidth:310];
+    [self resizeToWidth:300];
+    XCTAssertTrue(_pagingView.scrollView.isHidden);
+
+    // The turn needs the real pages, so they are shown and resized straight away, rather than once the size settles
+    [_pagingView turnToNextPageAnimated:NO];
+    XCTAssertFalse(_pagingView.scrollView.isHidden);
+    XCTAssertEqual(_pagingView.currentPageView.frame.size.width, 300);
+    XCTAssertEqual(_pagingView.previousPageView.frame.size.width, 300);
+}
+
+@end
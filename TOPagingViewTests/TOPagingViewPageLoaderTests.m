@@ -0,0 +1,334 @@
+//
+//  TOPagingViewPageLoaderTests.m
+//  TOPagingViewTests
+//
+//  Copyright © 2023 Tim Oliver. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "TOPagingView.h"
+#import "TOPagingViewPageLoader.h"
+#import "TOPagingViewResourcePolicy.h"
+
+/// A URL protocol that records every request the session starts and stops, and holds each
+/// one open until the test explicitly responds to it. All of its state is guarded by the class.
+@interface TOPageLoaderStubURLProtocol : NSURLProtocol
+@property (class, nonatomic, readonly) NSArray<NSURL *> *startedURLs;
+@property (class, nonatomic, readonly) NSArray<NSURL *> *stoppedURLs;
++ (void)reset;
++ (void)respondToURL:(NSURL *)url withData:(NSData *)data;
+@end
+
+static NSMutableArray<NSURL *> *TOPageLoaderStubStartedURLs;
+static NSMutableArray<NSURL *> *TOPageLoaderStubStoppedURLs;
+static NSMutableDictionary<NSURL *, TOPageLoaderStubURLProtocol *> *TOPageLoaderStubRunningProtocols;
+
+@implementation TOPageLoaderStubURLProtocol {
+    NSThread *_clientThread;
+}
+
++ (void)reset
+{
+    @synchronized (self) {
+        TOPageLoaderStubStartedURLs = [NSMutableArray array];
+        TOPageLoaderStubStoppedURLs = [NSMutableArray array];
+        TOPageLoaderStubRunningProtocols = [NSMutableDictionary dictionary];
+    }
+}
+
++ (NSArray<NSURL *> *)startedURLs { @synchronized (self) { return [TOPageLoaderStubStartedURLs copy]; } }
++ (NSArray<NSURL *> *)stoppedURLs { @synchronized (self) { return [TOPageLoaderStubStoppedURLs copy]; } }
+
++ (BOOL)canInitWithRequest:(NSURLRequest *)request { return YES; }
++ (NSURLRequest *)canonicalRequestForRequest:(NSURLRequest *)request { return request; }
+
+- (void)startLoading
+{
+    // The client must be messaged on the thread the request was started on
+    _clientThread = [NSThread currentThread];
+    @synchronized (self.class) {
+        [TOPageLoaderStubStartedURLs addObject:self.request.URL];
+        TOPageLoaderStubRunningProtocols[self.request.URL] = self;
+    }
+}
+
+- (void)stopLoading
+{
+    @synchronized (self.class) {
+        if (TOPageLoaderStubRunningProtocols[self.request.URL] != self) { return; }
+        [TOPageLoaderStubStoppedURLs addObject:self.request.URL];
+        [TOPageLoaderStubRunningProtocols removeObjectForKey:self.request.URL];
+    }
+}
+
++ (void)respondToURL:(NSURL *)url withData:(NSData *)data
+{
+    TOPageLoaderStubURLProtocol *protocol = nil;
+    @synchronized (self) {
+        protocol = TOPageLoaderStubRunningProtocols[url];
+        [TOPageLoaderStubRunningProtocols removeObjectForKey:url];
+    }
+    [protocol performSelector:@selector(_respondWithData:) onThread:protocol->_clientThread withObject:data waitUntilDone:NO];
+}
+
+- (void)_respondWithData:(NSData *)data
+{
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:self.request.URL statusCode:200
+                                                             HTTPVersion:@"HTTP/1.1" headerFields:nil];
+    [self.client URLProtocol:self didReceiveResponse:response cacheStoragePolicy:NSURLCacheStorageNotAllowed];
+    [self.client URLProtocol:self didLoadData:data];
+    [self.client URLProtocolDidFinishLoading:self];
+}
+
+@end
+
+// -----------------------------------------------------------------
+
+static inline NSURL *TOPageLoaderTestURL(NSInteger index)
+{
+    return [NSURL URLWithString:[NSString stringWithFormat:@"https://example.invalid/page-%ld", (long)index]];
+}
+
+@interface TOPageLoaderTestPageView : UIView <TOPagingViewPage>
+@property (nonatomic, assign) NSInteger number;
+@end
+
+@implementation TOPageLoaderTestPageView
+@end
+
+/// A document whose pages each load their content through a page loader.
+@interface TOPageLoaderTestDocument : NSObject <TOPagingViewDataSource>
+@property (nonatomic, assign) NSInteger pageIndex;
+@property (nonatomic, strong) TOPagingViewPageLoader *pageLoader;
+@end
+
+@implementation TOPageLoaderTestDocument
+
+- (UIView<TOPagingViewPage> *)pagingView:(TOPagingView *)pagingView
+                         pageViewForType:(TOPagingViewPageType)type
+                         currentPageView:(UIView<TOPagingViewPage> *)currentPageView
+{
+    NSInteger index = _pageIndex;
+    if (type == TOPagingViewPageTypeNext) { index++; }
+    else if (type == TOPagingViewPageTypePrevious) { index--; }
+    if (index < 0) { return nil; }
+
+    TOPageLoaderTestPageView *pageView = [pagingView dequeueReusablePageView];
+    pageView.number = index;
+    [_pageLoader loadURL:TOPageLoaderTestURL(index)
+                forOwner:pageView
+                distance:(type == TOPagingViewPageTypeCurrent) ? 0 : 1
+       completionHandler:^(NSData *data, NSError *error) {}];
+    return pageView;
+}
+
+@end
+
+// -----------------------------------------------------------------
+
+@interface TOPagingViewPageLoaderTests : XCTestCase
+@property (nonatomic, strong) TOPagingViewFixedResourcePolicy *resourcePolicy;
+@property (nonatomic, strong) TOPagingViewPageLoader *pageLoader;
+@end
+
+@implementation TOPagingViewPageLoaderTests
+
+- (void)setUp
+{
+    [TOPageLoaderStubURLProtocol reset];
+
+    NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration ephemeralSessionConfiguration];
+    configuration.protocolClasses = @[TOPageLoaderStubURLProtocol.class];
+    configuration.URLCache = nil;
+
+    TOPagingViewResourceLimits limits = [TOPagingViewDefaultResourcePolicy limitsForThermalState:NSProcessInfoThermalStateNominal
+                                                                           isLowPowerModeEnabled:NO];
+    limits.backgroundConcurrency = 1;
+    _resourcePolicy = [[TOPagingViewFixedResourcePolicy alloc] initWithLimits:limits];
+
+    _pageLoader = [[TOPagingViewPageLoader alloc] initWithSessionConfiguration:configuration];
+    _pageLoader.resourcePolicy = _resourcePolicy;
+}
+
+- (void)tearDown
+{
+    [_pageLoader cancelAllRequests];
+    _pageLoader = nil;
+}
+
+- (void)setBackgroundConcurrency:(NSUInteger)backgroundConcurrency
+{
+    TOPagingViewResourceLimits limits = _resourcePolicy.limits;
+    limits.backgroundConcurrency = backgroundConcurrency;
+    _resourcePolicy.limits = limits;
+}
+
+/// Runs the main run loop until the condition is met, or fails after a timeout.
+- (void)waitUntil:(BOOL (^)(void))condition description:(NSString *)description
+{
+    NSDate *const timeoutDate = [NSDate dateWithTimeIntervalSinceNow:2.0];
+    while (!condition() && [timeoutDate timeIntervalSinceNow] > 0.0) {
+        [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.01]];
+    }
+    XCTAssertTrue(condition(), @"Timed out waiting until %@", description);
+}
+
+- (void)waitUntilStartedCount:(NSUInteger)count
+{
+    [self waitUntil:^BOOL{ return TOPageLoaderStubURLProtocol.startedURLs.count >= count; }
+        description:[NSString stringWithFormat:@"%lu requests have started", (unsigned long)count]];
+}
+
+#pragma mark - Tests -
+
+- (void)testDuplicateURLsAreMerged
+{
+    NSObject *firstOwner = [NSObject new];
+    NSObject *secondOwner = [NSObject new];
+    NSObject *thirdOwner = [NSObject new];
+    NSData *const data = [@"page" dataUsingEncoding:NSUTF8StringEncoding];
+    __block NSUInteger firstCallCount = 0;
+    __block NSUInteger secondCallCount = 0;
+    __block NSUInteger thirdCallCount = 0;
+
+    [_pageLoader loadURL:TOPageLoaderTestURL(0) forOwner:firstOwner distance:0
+       completionHandler:^(NSData *receivedData, NSError *error) { firstCallCount++; }];
+    [_pageLoader loadURL:TOPageLoaderTestURL(0) forOwner:secondOwner distance:1
+       completionHandler:^(NSData *receivedData, NSError *error) {
+        XCTAssertEqualObjects(receivedData, data);
+        secondCallCount++;
+    }];
+    [_pageLoader loadURL:TOPageLoaderTestURL(0) forOwner:thirdOwner distance:1
+       completionHandler:^(NSData *receivedData, NSError *error) { thirdCallCount++; }];
+    XCTAssertEqual(_pageLoader.numberOfActiveRequests, 1);
+    XCTAssertEqual(_pageLoader.numberOfPendingRequests, 0);
+
+    // Cancelling one owner leaves the shared request running for the others
+    [_pageLoader cancelRequestsForOwner:firstOwner];
+    XCTAssertEqual(_pageLoader.numberOfActiveRequests, 1);
+
+    [self waitUntilStartedCount:1];
+    [TOPageLoaderStubURLProtocol respondToURL:TOPageLoaderTestURL(0) withData:data];
+    [self waitUntil:^BOOL{ return secondCallCount > 0 && thirdCallCount > 0; } description:@"the owners are called back"];
+
+    XCTAssertEqual(TOPageLoaderStubURLProtocol.startedURLs.count, 1);
+    XCTAssertEqual(firstCallCount, 0);
+    XCTAssertEqual(secondCallCount, 1);
+    XCTAssertEqual(thirdCallCount, 1);
+    XCTAssertEqual(_pageLoader.numberOfActiveRequests, 0);
+}
+
+- (void)testPendingRequestsStartInOrderOfDistance
+{
+    NSObject *owner = [NSObject new];
+    NSObject *farOwner = [NSObject new];
+    NSData *const data = [NSData data];
+    TOPagingViewPageLoaderCompletionHandler completionHandler = ^(NSData *receivedData, NSError *error) {};
+
+    // The first request takes the only slot, so the rest have to wait their turn
+    [_pageLoader loadURL:TOPageLoaderTestURL(0) forOwner:owner distance:3 completionHandler:completionHandler];
+    [_pageLoader loadURL:TOPageLoaderTestURL(1) forOwner:owner distance:3 completionHandler:completionHandler];
+    [_pageLoader loadURL:TOPageLoaderTestURL(2) forOwner:owner distance:2 completionHandler:completionHandler];
+    [_pageLoader loadURL:TOPageLoaderTestURL(3) forOwner:owner distance:0 completionHandler:completionHandler];
+    [_pageLoader loadURL:TOPageLoaderTestURL(4) forOwner:farOwner distance:4 completionHandler:completionHandler];
+    XCTAssertEqual(_pageLoader.numberOfActiveRequests, 1);
+    XCTAssertEqual(_pageLoader.numberOfPendingRequests, 4);
+
+    // Moving an owner closer to the current page moves its requests up the queue
+    [_pageLoader setDistance:1 forOwner:farOwner];
+
+    NSArray<NSURL *> *const expectedOrder = @[TOPageLoaderTestURL(0), TOPageLoaderTestURL(3), TOPageLoaderTestURL(4),
+                                              TOPageLoaderTestURL(2), TOPageLoaderTestURL(1)];
+    for (NSUInteger i = 0; i < expectedOrder.count; i++) {
+        [self waitUntilStartedCount:i + 1];
+        XCTAssertEqualObjects(TOPageLoaderStubURLProtocol.startedURLs[i], expectedOrder[i]);
+        [TOPageLoaderStubURLProtocol respondToURL:expectedOrder[i] withData:data];
+    }
+
+    [self waitUntil:^BOOL{ return self.pageLoader.numberOfActiveRequests == 0; } description:@"every request has finished"];
+    XCTAssertEqualObjects(TOPageLoaderStubURLProtocol.startedURLs, expectedOrder);
+}
+
+- (void)testConcurrencyFollowsResourcePolicy
+{
+    [self setBackgroundConcurrency:2];
+
+    NSObject *owner = [NSObject new];
+    for (NSInteger i = 0; i < 5; i++) {
+        [_pageLoader loadURL:TOPageLoaderTestURL(i) forOwner:owner distance:1
+           completionHandler:^(NSData *data, NSError *error) {}];
+    }
+    XCTAssertEqual(_pageLoader.numberOfActiveRequests, 2);
+    XCTAssertEqual(_pageLoader.numberOfPendingRequests, 3);
+    [self waitUntilStartedCount:2];
+
+    // Raising the limit starts more of the waiting requests straight away
+    [self setBackgroundConcurrency:4];
+    XCTAssertEqual(_pageLoader.numberOfActiveRequests, 4);
+    XCTAssertEqual(_pageLoader.numberOfPendingRequests, 1);
+    [self waitUntilStartedCount:4];
+
+    // Lowering it lets the running requests finish, but doesn't start any more until there's room
+    [self setBackgroundConcurrency:1];
+    NSArray<NSURL *> *const startedURLs = TOPageLoaderStubURLProtocol.startedURLs;
+    [TOPageLoaderStubURLProtocol respondToURL:startedURLs[0] withData:[NSData data]];
+    [self waitUntil:^BOOL{ return self.pageLoader.numberOfActiveRequests == 3; } description:@"the first request has finished"];
+    XCTAssertEqual(_pageLoader.numberOfPendingRequests, 1);
+    XCTAssertEqual(TOPageLoaderStubURLProtocol.startedURLs.count, 4);
+}
+
+- (void)testCancelledRequestsAreStopped
+{
+    [self setBackgroundConcurrency:2];
+
+    NSObject *owner = [NSObject new];
+    __block BOOL isCalledBack = NO;
+    [_pageLoader loadURL:TOPageLoaderTestURL(0) forOwner:owner distance:0
+       completionHandler:^(NSData *data, NSError *error) { isCalledBack = YES; }];
+    [self waitUntilStartedCount:1];
+
+    [_pageLoader cancelRequestsForOwner:owner];
+    XCTAssertEqual(_pageLoader.numberOfActiveRequests, 0);
+    [self waitUntil:^BOOL{ return [TOPageLoaderStubURLProtocol.stoppedURLs containsObject:TOPageLoaderTestURL(0)]; }
+        description:@"the cancelled request has stopped"];
+    XCTAssertFalse(isCalledBack);
+}
+
+- (void)testRecycledPagesCancelTheirRequests
+{
+    [self setBackgroundConcurrency:8];
+
+    TOPageLoaderTestDocument *document = [TOPageLoaderTestDocument new];
+    document.pageIndex = 1;
+    document.pageLoader = _pageLoader;
+
+    TOPagingView *pagingView = [[TOPagingView alloc] initWithFrame:(CGRect){0, 0, 320, 480}];
+    [pagingView registerPageViewClass:TOPageLoaderTestPageView.class];
+    pagingView.pageLoader = _pageLoader;
+    pagingView.dataSource = document;
+    [pagingView layoutIfNeeded];
+
+    // Pages 0, 1 and 2 are all loading
+    XCTAssertEqual(_pageLoader.numberOfActiveRequests, 3);
+    [self waitUntilStartedCount:3];
+
+    // Skipping hides and recycles all three pages, so only the new pages' requests should remain
+    document.pageIndex = 10;
+    [pagingView skipForwardToNewPageAnimated:NO];
+    XCTAssertEqual(_pageLoader.numberOfActiveRequests + _pageLoader.numberOfPendingRequests, 3);
+
+    NSArray<NSURL *> *const recycledURLs = @[TOPageLoaderTestURL(0), TOPageLoaderTestURL(1), TOPageLoaderTestURL(2)];
+    [self waitUntil:^BOOL{
+        NSArray<NSURL *> *const stoppedURLs = TOPageLoaderStubURLProtocol.stoppedURLs;
+        for (NSURL *url in recycledURLs) {
+            if (![stoppedURLs containsObject:url]) { return NO; }
+        }
+        return YES;
+    } description:@"the recycled pages' requests have stopped"];
+
+    for (NSInteger i = 9; i <= 11; i++) {
+        XCTAssertFalse([TOPageLoaderStubURLProtocol.stoppedURLs containsObject:TOPageLoaderTestURL(i)]);
+    }
+}
+
+@end
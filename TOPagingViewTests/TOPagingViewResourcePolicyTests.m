@@ -0,0 +1,97 @@
+//
+//  TOPagingViewResourcePolicyTests.m
+//  TOPagingViewTests
+//
+//  Copyright © 2023 Tim Oliver. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "TOPagingView.h"
+#import "TOPagingView+Testing.h"
+#import "TOPagingViewResourcePolicy.h"
+#import "TOPagingViewTestDocument.h"
+
+@interface TOPagingViewResourcePolicyTests : XCTestCase
+@property (nonatomic, strong) UIView *containerView;
+@property (nonatomic, strong) TOPagingViewTestDocument *document;
+@property (nonatomic, strong) TOPagingViewFixedResourcePolicy *resourcePolicy;
+@property (nonatomic, strong) TOPagingView *pagingView;
+@end
+
+@implementation TOPagingViewResourcePolicyTests
+
+- (void)setUp
+{
+    _containerView = [[UIView alloc] initWithFrame:(CGRect){0, 0, 320, 480}];
+
+    _document = [TOPagingViewTestDocument new];
+    _document.pageIndex = 5;
+    _document.lastPageIndex = 10;
+
+    TOPagingViewResourceLimits limits = [TOPagingViewDefaultResourcePolicy limitsForThermalState:NSProcessInfoThermalStateNominal
+                                                                          isLowPowerModeEnabled:NO];
+    _resourcePolicy = [[TOPagingViewFixedResourcePolicy alloc] initWithLimits:limits];
+
+    _pagingView = [[TOPagingView alloc] initWithFrame:_containerView.bounds];
+    [_pagingView registerPageViewClass:TOPagingViewTestPageView.class];
+    _pagingView.resourcePolicy = _resourcePolicy;
+    _pagingView.dataSource = _document;
+    _pagingView.delegate = _document;
+    [_containerView addSubview:_pagingView];
+    [_pagingView layoutIfNeeded];
+}
+
+- (NSUInteger)pooledPageCount
+{
+    NSUInteger count = 0;
+    for (NSMutableSet *pool in _pagingView.queuedPages.allValues) { count += pool.count; }
+    return count;
+}
+
+- (void)setPagePoolCapacity:(NSUInteger)pagePoolCapacity prefetchRadius:(NSUInteger)prefetchRadius
+{
+    TOPagingViewResourceLimits limits = _resourcePolicy.limits;
+    limits.pagePoolCapacity = pagePoolCapacity;
+    limits.prefetchRadius = prefetchRadius;
+    _resourcePolicy.limits = limits;
+}
+
+- (void)testLoweringPoolCapacityTrimsRecycledPages
+{
+    // Narrow the document to a single page, so skipping to it recycles both adjacent pages and the old current page
+    _document.firstPageIndex = 5;
+    _document.lastPageIndex = 5;
+    [_pagingView skipForwardToNewPageAnimated:NO];
+    XCTAssertNil(_pagingView.nextPageView);
+    XCTAssertNil(_pagingView.previousPageView);
+    XCTAssertGreaterThanOrEqual([self pooledPageCount], 2);
+
+    // Changing the policy trims the pool straight away, without waiting for another page to be recycled
+    [self setPagePoolCapacity:1 prefetchRadius:1];
+    XCTAssertEqual([self pooledPageCount], 1);
+
+    [self setPagePoolCapacity:0 prefetchRadius:1];
+    XCTAssertEqual([self pooledPageCount], 0);
+    XCTAssertEqual(((TOPagingViewTestPageView *)_pagingView.currentPageView).number, 5);
+}
+
+- (void)testPrewarmIsSuppressedAtZeroRadius
+{
+    // At a radius of 0, the adjacent pages are still fetched, but aren't queued to be prepared ahead of time
+    [self setPagePoolCapacity:4 prefetchRadius:0];
+    _document.pageIndex = 7;
+    [_pagingView skipForwardToNewPageAnimated:NO];
+    XCTAssertEqual(((TOPagingViewTestPageView *)_pagingView.nextPageView).number, 8);
+    XCTAssertEqual(((TOPagingViewTestPageView *)_pagingView.previousPageView).number, 6);
+    XCTAssertFalse(_pagingView.needsNextPagePrewarm);
+    XCTAssertFalse(_pagingView.needsPreviousPagePrewarm);
+
+    // Once allowed again, newly fetched pages are queued for the next idle point
+    [self setPagePoolCapacity:4 prefetchRadius:1];
+    _document.pageIndex = 3;
+    [_pagingView skipBackwardToNewPageAnimated:NO];
+    XCTAssertTrue(_pagingView.needsNextPagePrewarm);
+    XCTAssertTrue(_pagingView.needsPreviousPagePrewarm);
+}
+
+@end
@@ -0,0 +1,196 @@
+//
+//  TOPagingViewStateFuzzTests.m
+//  TOPagingViewTests
+//
+//  Copyright © 2023 Tim Oliver. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "TOPagingView.h"
+#import "TOPagingViewTestDocument.h"
+#import "TOPagingView+Testing.h"
+
+/// The number of independent random sequences to run, and the number of steps in each.
+static const NSUInteger kTOFuzzSeedCount = 64;
+static const NSUInteger kTOFuzzStepCount = 400;
+
+/// How long to let any in-flight animations run when settling. The window's layers run at
+/// `kTOFuzzAnimationSpeed` times normal speed, so this covers even the longest skip animation.
+static const NSTimeInterval kTOFuzzSettleDuration = 0.05;
+static const float kTOFuzzAnimationSpeed = 100.0f;
+
+// -----------------------------------------------------------------
+
+/// A small, seedable PRNG (xorshift64*) so any failing sequence can be replayed exactly.
+typedef struct {
+    uint64_t state;
+} TOFuzzRandom;
+
+static inline uint64_t TOFuzzRandomNext(TOFuzzRandom *random)
+{
+    uint64_t x = random->state;
+    x ^= x >> 12; x ^= x << 25; x ^= x >> 27;
+    random->state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+static inline NSInteger TOFuzzRandomInRange(TOFuzzRandom *random, NSInteger min, NSInteger max)
+{
+    return min + (NSInteger)(TOFuzzRandomNext(random) % (uint64_t)(max - min + 1));
+}
+
+// -----------------------------------------------------------------
+
+@interface TOPagingViewStateFuzzTests : XCTestCase
+@end
+
+@implementation TOPagingViewStateFuzzTests
+
+- (void)testRandomSequencesPreserveInvariants
+{
+    for (NSUInteger seed = 1; seed <= kTOFuzzSeedCount; seed++) {
+        [self runSequenceWithSeed:seed];
+    }
+}
+
+- (void)runSequenceWithSeed:(uint64_t)seed
+{
+    TOFuzzRandom random = (TOFuzzRandom){seed * 0x9E3779B97F4A7C15ULL};
+
+    TOPagingViewTestDocument *document = [TOPagingViewTestDocument new];
+    document.firstPageIndex = -5;
+    document.lastPageIndex = 5;
+
+    // Host the paging view in a window so animations actually run, sped up so they can be settled quickly
+    UIWindow *window = [[UIWindow alloc] initWithFrame:(CGRect){0, 0, 320, 480}];
+    window.layer.speed = kTOFuzzAnimationSpeed;
+    window.hidden = NO;
+
+    TOPagingView *pagingView = [[TOPagingView alloc] initWithFrame:window.bounds];
+    [pagingView registerPageViewClass:TOPagingViewTestPageView.class];
+    pagingView.dataSource = document;
+    pagingView.delegate = document;
+    [window addSubview:pagingView];
+    [pagingView layoutIfNeeded];
+    [pagingView resetMetrics];
+
+    // Whether an animated turn or skip may still be in flight
+    BOOL isAnimating = NO;
+
+    for (NSUInteger step = 0; step < kTOFuzzStepCount; step++) {
+        const NSInteger action = TOFuzzRandomInRange(&random, 0, 13);
+        UIScrollView *const scrollView = pagingView.scrollView;
+        const CGFloat segmentWidth = CGRectGetWidth(scrollView.frame);
+
+        switch (action) {
+            case 0: case 1: case 2: { // Scroll to an arbitrary offset, as if dragged
+                const CGFloat offset = segmentWidth * ((CGFloat)TOFuzzRandomInRange(&random, 0, 200) / 100.0f);
+                scrollView.contentOffset = (CGPoint){offset, 0.0f};
+                break;
+            }
+            case 3: // Run a layout pass, which requests any pending pages
+                [pagingView layoutIfNeeded];
+                break;
+            case 4: // Turn a page in either direction
+                if (TOFuzzRandomInRange(&random, 0, 1)) { [pagingView turnToNextPageAnimated:NO]; }
+                else { [pagingView turnToPreviousPageAnimated:NO]; }
+                break;
+            case 5: { // Change which pages are available, always keeping the current one
+                document.firstPageIndex = MIN(document.pageIndex, document.pageIndex - TOFuzzRandomInRange(&random, 0, 3));
+                document.lastPageIndex = MAX(document.pageIndex, document.pageIndex + TOFuzzRandomInRange(&random, 0, 3));
+                if (TOFuzzRandomInRange(&random, 0, 1)) { [pagingView fetchAdjacentPagesIfAvailable]; }
+                break;
+            }
+            case 6: case 11: { // Jump to an arbitrary page, sometimes animated with any of the skip styles
+                const BOOL isAnimated = (action == 11);
+                const NSInteger delta = TOFuzzRandomInRange(&random, 2, 20);
+                const BOOL isForward = TOFuzzRandomInRange(&random, 0, 1);
+                if (isAnimated) { pagingView.skipTransitionStyle = (TOPagingViewSkipTransitionStyle)TOFuzzRandomInRange(&random, 0, 2); }
+                document.pageIndex += isForward ? delta : -delta;
+                document.firstPageIndex = MIN(document.firstPageIndex, document.pageIndex);
+                document.lastPageIndex = MAX(document.lastPageIndex, document.pageIndex);
+                if (isForward) { [pagingView skipForwardToNewPageAnimated:isAnimated]; }
+                else { [pagingView skipBackwardToNewPageAnimated:isAnimated]; }
+                isAnimating = isAnimating || isAnimated;
+                break;
+            }
+            case 7:
+                [pagingView reloadAdjacentPages];
+                break;
+            case 8:
+                pagingView.pageScrollDirection = (pagingView.pageScrollDirection == TOPagingViewDirectionLeftToRight) ?
+                                                    TOPagingViewDirectionRightToLeft : TOPagingViewDirectionLeftToRight;
+                break;
+            case 9:
+                [pagingView reload];
+                break;
+            case 10: // Turn a page in either direction, animated
+                if (TOFuzzRandomInRange(&random, 0, 1)) { [pagingView turnToNextPageAnimated:YES]; }
+                else { [pagingView turnToPreviousPageAnimated:YES]; }
+                isAnimating = YES;
+                break;
+            case 12: // Toggle dynamic page direction detection, which reloads the paging view
+                pagingView.isDynamicPageDirectionEnabled = !pagingView.isDynamicPageDirectionEnabled;
+                break;
+            case 13: // Let any animations in flight finish, along with any work they deferred
+                [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:kTOFuzzSettleDuration]];
+                isAnimating = NO;
+                break;
+        }
+
+        // Let the main queue run once so any work deferred to the next tick interleaves with the following steps
+        if (isAnimating) { CFRunLoopRunInMode(kCFRunLoopDefaultMode, 0.0, true); }
+
+        NSString *const context = [NSString stringWithFormat:@"seed %llu, step %lu, action %ld",
+                                   (unsigned long long)seed, (unsigned long)step, (long)action];
+        XCTAssertEqual(pagingView.metrics.dataSourceBudgetOverrunCount, 0,
+                       @"A transition made more data source requests than its budget (%@)", context);
+        if (![self verifyInvariantsOfPagingView:pagingView document:document
+                                    isAnimating:isAnimating context:context]) { break; }
+    }
+
+    window.hidden = YES;
+}
+
+- (BOOL)verifyInvariantsOfPagingView:(TOPagingView *)pagingView
+                            document:(TOPagingViewTestDocument *)document
+                         isAnimating:(BOOL)isAnimating
+                             context:(NSString *)context
+{
+    TOPagingViewTestPageView *const currentPageView = pagingView.currentPageView;
+    TOPagingViewTestPageView *const nextPageView = pagingView.nextPageView;
+    TOPagingViewTestPageView *const previousPageView = pagingView.previousPageView;
+
+    // No page may ever be in two slots at once
+    BOOL isValid = YES;
+    if (nextPageView && nextPageView == currentPageView) { isValid = NO; }
+    if (previousPageView && previousPageView == currentPageView) { isValid = NO; }
+    if (nextPageView && nextPageView == previousPageView) { isValid = NO; }
+    XCTAssertTrue(isValid, @"The same page is in two slots (%@)", context);
+
+    // The current page must always match the document
+    XCTAssertNotNil(currentPageView, @"There is no current page (%@)", context);
+    XCTAssertEqual(currentPageView.number, document.pageIndex, @"The current page is out of sync (%@)", context);
+    if (currentPageView == nil || currentPageView.number != document.pageIndex) { isValid = NO; }
+
+    // Every visible page must be on screen, and no recycled page may be visible
+    // (An adjacent page is kept hidden while an animated skip's outgoing page is still leaving its slot)
+    NSArray *const visiblePageViews = pagingView.orderedVisiblePageViews;
+    for (UIView *pageView in visiblePageViews) {
+        if (!isAnimating) { XCTAssertFalse(pageView.hidden, @"A visible page is hidden (%@)", context); }
+        XCTAssertTrue([pageView isDescendantOfView:pagingView.scrollView], @"A visible page isn't in the scroll view (%@)", context);
+    }
+
+    for (NSSet *pageViews in pagingView.queuedPages.allValues) {
+        for (UIView *pageView in pageViews) {
+            const BOOL isOnScreen = !pageView.hidden && [pageView isDescendantOfView:pagingView.scrollView];
+            if (![visiblePageViews containsObject:pageView] && !isOnScreen) { continue; }
+            XCTFail(@"A recycled page is also visible (%@)", context);
+            isValid = NO;
+        }
+    }
+
+    return isValid;
+}
+
+@end
@@ -0,0 +1,35 @@
+//
+//  TOPagingViewTestDocument.h
+//  TOPagingViewTests
+//
+//  Copyright © 2023 Tim Oliver. All rights reserved.
+//
+
+#import "TOPagingView.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A page that shows a single numbered page of a `TOPagingViewTestDocument`.
+@interface TOPagingViewTestPageView : UIView <TOPagingViewPage>
+
+/// The index of the page in the document. Pages are reset to `NSIntegerMin` when they are re-used.
+@property (nonatomic, assign) NSInteger number;
+
+@end
+
+// -----------------------------------------------------------------
+
+/// A document with a range of numbered pages, tracking which one is current as the paging view turns.
+/// The range may be changed at any time, after which the paging view needs to be told to fetch again.
+@interface TOPagingViewTestDocument : NSObject <TOPagingViewDataSource, TOPagingViewDelegate>
+
+/// The index of the current page.
+@property (nonatomic, assign) NSInteger pageIndex;
+
+/// The indices of the first and last pages available (default is 0 for both).
+@property (nonatomic, assign) NSInteger firstPageIndex;
+@property (nonatomic, assign) NSInteger lastPageIndex;
+
+@end
+
+NS_ASSUME_NONNULL_END
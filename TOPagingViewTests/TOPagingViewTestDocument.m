@@ -0,0 +1,40 @@
+//
+//  TOPagingViewTestDocument.m
+//  TOPagingViewTests
+//
+//  Copyright © 2023 Tim Oliver. All rights reserved.
+//
+
+#import "TOPagingViewTestDocument.h"
+
+@implementation TOPagingViewTestPageView
+- (NSString *)uniqueIdentifier { return [NSString stringWithFormat:@"%ld", (long)_number]; }
+- (void)prepareForReuse { _number = NSIntegerMin; }
+- (BOOL)isInitialPage { return _number == 0; }
+@end
+
+// -----------------------------------------------------------------
+
+@implementation TOPagingViewTestDocument
+
+- (UIView<TOPagingViewPage> *)pagingView:(TOPagingView *)pagingView
+                         pageViewForType:(TOPagingViewPageType)type
+                         currentPageView:(UIView<TOPagingViewPage> *)currentPageView
+{
+    NSInteger index = _pageIndex;
+    if (type == TOPagingViewPageTypeNext) { index++; }
+    else if (type == TOPagingViewPageTypePrevious) { index--; }
+    if (index < _firstPageIndex || index > _lastPageIndex) { return nil; }
+
+    TOPagingViewTestPageView *pageView = [pagingView dequeueReusablePageView];
+    pageView.number = index;
+    return pageView;
+}
+
+- (void)pagingView:(TOPagingView *)pagingView didTurnToPageOfType:(TOPagingViewPageType)type
+{
+    if (type == TOPagingViewPageTypeNext) { _pageIndex++; }
+    else if (type == TOPagingViewPageTypePrevious) { _pageIndex--; }
+}
+
+@end